@@ -0,0 +1,173 @@
+/**
+* @file example3_coro_benchmark.cpp
+* @brief This file compares the performance of a generator based on JSON_STREAM_GEN_* macros with the same generator
+*   written as a C++20 coroutine (see "include/json_stream_gen_coro.hpp") on a large JSON document.
+*   The macro-based callback re-walks all the items generated in the previous chunks on every chunk,
+*   while the coroutine is suspended when the chunk is full and continues from the same point on the next chunk.
+*   Both generators produce the same JSON data, the example checks it and prints the time spent by each of them.
+*
+*   Build it from the 'examples' folder:
+*   gcc -O2 -c ../src/json_stream_gen.c -I ../include -o json_stream_gen.o
+*   g++ -O2 -std=c++20 example3_coro_benchmark.cpp json_stream_gen.o -I ../include -lm -o example3_coro_benchmark
+*   or with CMake from the root folder by enabling the option JSON_STREAM_GEN_BUILD_CORO_EXAMPLE.
+* @author TheSomeMan
+* @date 2026-10-17
+* @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "../include/json_stream_gen_coro.hpp"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Defines a record of the user data, which is converted to a JSON object.
+ */
+typedef struct record_t
+{
+    uint32_t id;
+    int32_t  temperature;
+    uint32_t humidity;
+    bool     flag_active;
+} record_t;
+
+/**
+ * @brief Defines the user data, which is converted to an array of JSON objects.
+ */
+typedef struct user_data_t
+{
+    const record_t* p_records;
+    size_t          num_records;
+    size_t          idx;
+} user_data_t;
+
+/**
+ * @brief Callback function for JSON generation based on JSON_STREAM_GEN_* macros.
+ */
+static json_stream_gen_callback_result_t
+callback_generate_json(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    user_data_t* const p_ctx = (user_data_t*)p_user_ctx;
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "records");
+    for (p_ctx->idx = 0; p_ctx->idx < p_ctx->num_records; ++p_ctx->idx)
+    {
+        const record_t* const p_record = &p_ctx->p_records[p_ctx->idx];
+        JSON_STREAM_GEN_ADD_OBJECT_TO_ARRAY(p_gen);
+        JSON_STREAM_GEN_ADD_UINT32(p_gen, "id", p_record->id);
+        JSON_STREAM_GEN_ADD_INT32(p_gen, "temperature", p_record->temperature);
+        JSON_STREAM_GEN_ADD_UINT32(p_gen, "humidity", p_record->humidity);
+        JSON_STREAM_GEN_ADD_BOOL(p_gen, "active", p_record->flag_active);
+        JSON_STREAM_GEN_END_OBJECT(p_gen);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+/**
+ * @brief The same generator written as a coroutine.
+ */
+static json_stream_gen::Coroutine
+coroutine_generate_json(json_stream_gen_t* const p_gen, const record_t* const p_records, const size_t num_records)
+{
+    co_yield json_stream_gen::item(&json_stream_gen_start_array, p_gen, "records");
+    for (size_t i = 0; i < num_records; ++i)
+    {
+        const record_t* const p_record = &p_records[i];
+        co_yield json_stream_gen::item(&json_stream_gen_start_object, p_gen, nullptr);
+        co_yield json_stream_gen::item(&json_stream_gen_add_uint32, p_gen, "id", p_record->id);
+        co_yield json_stream_gen::item(&json_stream_gen_add_int32, p_gen, "temperature", p_record->temperature);
+        co_yield json_stream_gen::item(&json_stream_gen_add_uint32, p_gen, "humidity", p_record->humidity);
+        co_yield json_stream_gen::item(&json_stream_gen_add_bool, p_gen, "active", p_record->flag_active);
+        co_yield json_stream_gen::item(&json_stream_gen_end_object, p_gen);
+    }
+    co_yield json_stream_gen::item(&json_stream_gen_end_array, p_gen);
+}
+
+/**
+ * @brief Generates the whole JSON data chunk by chunk.
+ * @return Returns the generated JSON data or an empty string in case of an error.
+ */
+static std::string
+generate_json(json_stream_gen_t* const p_gen)
+{
+    std::string json_str;
+    while (true)
+    {
+        const char* const p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            return std::string();
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        json_str += p_chunk;
+    }
+    return json_str;
+}
+
+int
+main(void)
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 512,
+        .flag_formatted_json    = false,
+        .indentation_mark       = ' ',
+        .indentation            = 0,
+        .max_nesting_level      = 0,
+        .p_malloc               = nullptr,
+        .p_free                 = nullptr,
+        .p_localeconv           = nullptr,
+        .sub_func_cache_size    = 0,
+        .spill_buf_size         = 0,
+        .flag_split_long_values = false,
+        .flag_pack_chunks       = false,
+        .flag_hex_lowercase     = false,
+    };
+
+    std::vector<record_t> records(5000);
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        records[i].id          = (uint32_t)i;
+        records[i].temperature = (int32_t)(i % 80) - 30;
+        records[i].humidity    = (uint32_t)(i % 100);
+        records[i].flag_active = (0 == (i % 3));
+    }
+
+    user_data_t*       p_ctx = nullptr;
+    json_stream_gen_t* p_gen = json_stream_gen_create(&cfg, &callback_generate_json, sizeof(*p_ctx), (void**)&p_ctx);
+    if (nullptr == p_gen)
+    {
+        fprintf(stderr, "Failed to create json_stream_gen\n");
+        return 1;
+    }
+    p_ctx->p_records   = records.data();
+    p_ctx->num_records = records.size();
+
+    const auto        macro_start_time = std::chrono::steady_clock::now();
+    const std::string macro_json       = generate_json(p_gen);
+    const auto        macro_end_time   = std::chrono::steady_clock::now();
+    json_stream_gen_delete(&p_gen);
+
+    json_stream_gen::CoroGenerator coro_gen(&cfg, [&records](json_stream_gen_t* const p_coro_gen) {
+        return coroutine_generate_json(p_coro_gen, records.data(), records.size());
+    });
+    const auto        coro_start_time = std::chrono::steady_clock::now();
+    const std::string coro_json       = generate_json(coro_gen.get());
+    const auto        coro_end_time   = std::chrono::steady_clock::now();
+
+    if (macro_json.empty() || (macro_json != coro_json))
+    {
+        fprintf(stderr, "The generated JSON data are different\n");
+        return 1;
+    }
+    const auto macro_time = std::chrono::duration_cast<std::chrono::microseconds>(macro_end_time - macro_start_time);
+    const auto coro_time  = std::chrono::duration_cast<std::chrono::microseconds>(coro_end_time - coro_start_time);
+    printf("JSON size: %zu bytes, chunk size: %d bytes\n", macro_json.size(), (int)cfg.max_chunk_size);
+    printf("Macros:    %lld us\n", (long long)macro_time.count());
+    printf("Coroutine: %lld us\n", (long long)coro_time.count());
+    return 0;
+}
@@ -25,11 +25,13 @@
 extern "C" {
 #endif
 
-#define JSON_STREAM_GEN_CFG_DEFAULT_MAX_CHUNK_SIZE    (1024)
-#define JSON_STREAM_GEN_CFG_MIN_CHUNK_SIZE            (8)
-#define JSON_STREAM_GEN_CFG_DEFAULT_MAX_NESTING_LEVEL (5U)
-#define JSON_STREAM_GEN_CFG_DEFAULT_INDENTATION       (2U)
-#define JSON_STREAM_GEN_CFG_DEFAULT_INDENTATION_MARK  (' ')
+#define JSON_STREAM_GEN_CFG_DEFAULT_MAX_CHUNK_SIZE      (1024)
+#define JSON_STREAM_GEN_CFG_MIN_CHUNK_SIZE              (8)
+#define JSON_STREAM_GEN_CFG_DEFAULT_MAX_NESTING_LEVEL   (5U)
+#define JSON_STREAM_GEN_CFG_DEFAULT_INDENTATION         (2U)
+#define JSON_STREAM_GEN_CFG_DEFAULT_INDENTATION_MARK    (' ')
+#define JSON_STREAM_GEN_CFG_DEFAULT_SUB_FUNC_CACHE_SIZE (0U)
+#define JSON_STREAM_GEN_CFG_DEFAULT_SPILL_BUF_SIZE      (0)
 
 /**
  * @brief json_stream_gen_t is a struct that defines JSON generator object.
@@ -69,6 +71,45 @@ typedef struct json_stream_gen_callback_result_t
 typedef json_stream_gen_callback_result_t (
     *json_stream_gen_cb_generate_next_t)(json_stream_gen_t* const p_gen, const void* const p_user_ctx);
 
+/**
+ * @brief Enumerates the potential results of executing a JSON array iterator callback function.
+ */
+typedef enum json_stream_gen_iter_result_e
+{
+    JSON_STREAM_GEN_ITER_RESULT_NEXT,     ///< The element was added, the iterator should be called for the next one.
+    JSON_STREAM_GEN_ITER_RESULT_END,      ///< There are no more elements in the array.
+    JSON_STREAM_GEN_ITER_RESULT_OVERFLOW, ///< The element was not added because of a chunk overflow or error.
+} json_stream_gen_iter_result_e;
+
+/**
+ * @brief Wraps the json_stream_gen_iter_result_e enum.
+ *
+ * This struct is used to prevent implicit type conversion in C.
+ * It contains the result of an iterator callback function execution.
+ */
+typedef struct json_stream_gen_iter_result_t
+{
+    json_stream_gen_iter_result_e iter_res;
+} json_stream_gen_iter_result_t;
+
+/**
+ * @brief Defines the function signature for a JSON array iterator callback.
+ *
+ * This callback is expected to add the array element with the given index using one of the json_stream_gen_add_*
+ * functions with a NULL name. If the element does not fit into the current chunk, the callback will be called
+ * again with the same index while the next chunk is generated.
+ *
+ * @param p_gen       A pointer to the JSON generator object.
+ * @param p_iter_ctx  A pointer to user-defined iterator data.
+ * @param idx         The index of the array element to add.
+ *
+ * @return A json_stream_gen_iter_result_t indicating the outcome of adding the array element.
+ */
+typedef json_stream_gen_iter_result_t (*json_stream_gen_cb_iter_next_t)(
+    json_stream_gen_t* const p_gen,
+    void* const              p_iter_ctx,
+    const size_t             idx);
+
 /**
  * @brief json_stream_gen_size_t is a type definition for the size of JSON stream generator's output.
  */
@@ -109,6 +150,11 @@ typedef struct json_stream_gen_cfg_t
     json_stream_gen_malloc_t     p_malloc;          ///< Function pointer to replace standard 'malloc'.
     json_stream_gen_free_t       p_free;            ///< Function pointer to replace standard 'free'.
     json_stream_gen_localeconv_t p_localeconv;      ///< Function pointer to replace standard 'localeconv'.
+    uint32_t                     sub_func_cache_size; ///< Number of completed sub-generators to skip (0 - disabled).
+    json_stream_gen_size_t       spill_buf_size; ///< Size of buffer for the item that overflowed chunk (0 - disabled).
+    bool                         flag_split_long_values; ///< True enables splitting long strings between chunks.
+    bool                         flag_pack_chunks; ///< True fills every chunk up to max_chunk_size (except the last).
+    bool                         flag_hex_lowercase; ///< True prints hex buffers with lowercase digits ('a'-'f').
 } json_stream_gen_cfg_t;
 
 typedef int json_stream_gen_ieee754_precision_t;
@@ -152,6 +198,62 @@ json_stream_gen_get_next_chunk(json_stream_gen_t* const p_gen);
 json_stream_gen_size_t
 json_stream_gen_calc_size(json_stream_gen_t* const p_gen);
 
+/**
+ * @brief Moves the generator to the given byte offset of the JSON data, e.g. to resume an interrupted download.
+ * @details The items before the offset are not written to the chunk buffer, only their length is calculated,
+ * so seeking is much cheaper than generating and discarding the chunks.
+ * The next call to json_stream_gen_get_next_chunk returns the JSON data starting from the given offset.
+ * The generator is reset before seeking, so it can be called at any time.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param byte_offset is the offset from the beginning of the JSON data.
+ * @return Returns false if the offset is beyond the end of the JSON data or if the generation failed.
+ */
+bool
+json_stream_gen_seek(json_stream_gen_t* const p_gen, const json_stream_gen_size_t byte_offset);
+
+/**
+ * @brief Returns the size of the buffer required to save the state of the generator.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @return Returns the size of the saved state in bytes.
+ */
+size_t
+json_stream_gen_get_saved_state_size(const json_stream_gen_t* const p_gen);
+
+/**
+ * @brief Saves the position of the generator between chunks, so that the generation can be continued later.
+ * @details The saved state is a plain blob, which contains the resumable state and the bytes pending
+ * to be flushed to the next chunk. The generator can be reused for generating other JSON data meanwhile.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_buf is a pointer to the buffer for the saved state.
+ * @param buf_size is the size of the buffer, it should be at least json_stream_gen_get_saved_state_size.
+ * @return Returns false if the buffer is too small.
+ */
+bool
+json_stream_gen_save_state(const json_stream_gen_t* const p_gen, void* const p_buf, const size_t buf_size);
+
+/**
+ * @brief Restores the position of the generator saved by json_stream_gen_save_state.
+ * @note The generator must be created with the same configuration, callback and user context as the one
+ * which state was saved. The user context is not a part of the saved state, so the variables of the resumable
+ * generators which are kept in the user context should be saved separately.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_buf is a pointer to the saved state.
+ * @param buf_size is the size of the saved state.
+ * @return Returns false if the saved state is invalid or incompatible with the generator.
+ */
+bool
+json_stream_gen_restore_state(json_stream_gen_t* const p_gen, const void* const p_buf, const size_t buf_size);
+
+/**
+ * @brief Re-reads the decimal point of the current locale.
+ * @details The decimal point is obtained from the 'localeconv' callback once when the generator is created,
+ * and it is used to convert the floating-point numbers printed with the given precision or with the fixed point.
+ * Call this function after the locale is changed by 'setlocale'.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ */
+void
+json_stream_gen_refresh_locale(json_stream_gen_t* const p_gen);
+
 /**
  * @brief Resets the json_stream_gen_t instance to its initial state.
  * @param p_gen is a pointer to a json_stream_gen_t instance.
@@ -176,6 +278,78 @@ json_stream_gen_check_stage_internal(json_stream_gen_t* const p_gen);
 void
 json_stream_gen_inc_stage_internal(json_stream_gen_t* const p_gen);
 
+/**
+ * @brief Restores the step of JSON generation saved at the last resume point.
+ * @note This function if for internal usage only (in macro).
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @return Returns the identifier of the last resume point passed (0 if there was no resume point).
+ */
+int32_t
+json_stream_gen_resume_internal(json_stream_gen_t* const p_gen);
+
+/**
+ * @brief Saves the resume point and the current step of JSON generation.
+ * @note This function if for internal usage only (in macro).
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param resume_point is the identifier of the resume point (the line number in the source file).
+ */
+void
+json_stream_gen_set_resume_point_internal(json_stream_gen_t* const p_gen, const int32_t resume_point);
+
+/**
+ * @brief Checks if the sub-generator called at the current step has been already completed in the previous chunks.
+ * @details If the sub-generator was completed, then the current step is advanced by the number of steps
+ * it consumed, so the sub-generator does not need to be called.
+ * @note This function if for internal usage only (in macro).
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @return Returns the current step if the sub-generator needs to be called or -1 if it should be skipped.
+ */
+int32_t
+json_stream_gen_begin_sub_func_internal(json_stream_gen_t* const p_gen);
+
+/**
+ * @brief Saves the number of steps consumed by the completed sub-generator.
+ * @note This function if for internal usage only (in macro).
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param start_step is the step returned by json_stream_gen_begin_sub_func_internal.
+ */
+void
+json_stream_gen_end_sub_func_internal(json_stream_gen_t* const p_gen, const int32_t start_step);
+
+/**
+ * @brief Remembers the length of the string literal passed as a key with JSON_STREAM_GEN_KEY.
+ * @note This function if for internal usage only (in macro).
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_key is the string literal.
+ * @param key_len is the length of the string literal.
+ * @return Returns p_key.
+ */
+const char*
+json_stream_gen_set_literal_key_internal(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_key,
+    const size_t             key_len);
+
+/**
+ * @brief Macro to pass a string literal as the key of an item without calculating its length at runtime.
+ * @details This is an opt-in path: only the keys wrapped with this macro skip strlen, the keys passed directly
+ *          to JSON_STREAM_GEN_ADD_* macros are still measured at runtime (they may be NULL or char pointers).
+ *          The key is still scanned to escape the special characters.
+ * @note The macro should be used only as the key argument of the macro or the function which adds the item.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is a string literal.
+ */
+#define JSON_STREAM_GEN_KEY(p_gen, key) json_stream_gen_set_literal_key_internal(p_gen, "" key, sizeof(key) - 1U)
+
+#if defined(__GNUC__) && (__GNUC__ >= 7)
+#define JSON_STREAM_GEN_FALLTHROUGH_INTERNAL() __attribute__((fallthrough))
+#else
+#define JSON_STREAM_GEN_FALLTHROUGH_INTERNAL() \
+    do \
+    { \
+    } while (0)
+#endif
+
 /**
  * @brief A macro that provides default configuration for a json_stream_gen_cfg_t instance.
  */
@@ -186,7 +360,9 @@ json_stream_gen_inc_stage_internal(json_stream_gen_t* const p_gen);
         .indentation_mark  = JSON_STREAM_GEN_CFG_DEFAULT_INDENTATION_MARK, \
         .max_nesting_level = JSON_STREAM_GEN_CFG_DEFAULT_MAX_NESTING_LEVEL, \
         .indentation = JSON_STREAM_GEN_CFG_DEFAULT_INDENTATION, .p_malloc = &malloc, .p_free = &free, \
-        .p_localeconv = &localeconv, \
+        .p_localeconv = &localeconv, .sub_func_cache_size = JSON_STREAM_GEN_CFG_DEFAULT_SUB_FUNC_CACHE_SIZE, \
+        .spill_buf_size = JSON_STREAM_GEN_CFG_DEFAULT_SPILL_BUF_SIZE, .flag_split_long_values = false, \
+        .flag_pack_chunks = false, .flag_hex_lowercase = false, \
     }
 
 /**
@@ -203,6 +379,46 @@ json_stream_gen_inc_stage_internal(json_stream_gen_t* const p_gen);
         .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_FINISH, \
     }
 
+/**
+ * @brief Macro to mark the start of a resumable JSON generator callback function.
+ * @details A resumable callback does not re-walk all the items generated in the previous chunks:
+ * every chunk jumps directly to the last JSON_STREAM_GEN_RESUME_POINT passed before the previous chunk overflowed
+ * (in the protothread style), so only the items between this resume point and the end of the chunk are re-walked.
+ * As with protothreads, local variables of the callback are not preserved between chunks, so loop counters
+ * and other state must be kept in the user context, local variables must not be declared after this macro,
+ * and JSON_STREAM_GEN_RESUME_POINT can be used only directly in this callback (not in sub-generators).
+ * @note The callback must be finished with JSON_STREAM_GEN_END_RESUMABLE_GENERATOR_FUNC.
+ */
+#define JSON_STREAM_GEN_BEGIN_RESUMABLE_GENERATOR_FUNC(p_gen) \
+    switch (json_stream_gen_resume_internal(p_gen)) \
+    { \
+        default: \
+            json_stream_gen_begin_generator_func(p_gen); \
+            JSON_STREAM_GEN_FALLTHROUGH_INTERNAL(); \
+        case 0:
+
+/**
+ * @brief Macro to mark a point from which a resumable JSON generator callback function continues on the next chunk.
+ * @note This macro should be used only inside a resumable JSON generator callback function,
+ * no more than once per line.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ */
+#define JSON_STREAM_GEN_RESUME_POINT(p_gen) \
+    JSON_STREAM_GEN_FALLTHROUGH_INTERNAL(); \
+    case __LINE__: \
+        json_stream_gen_set_resume_point_internal(p_gen, __LINE__)
+
+/**
+ * @brief Macro to mark the end of a resumable JSON generator callback function.
+ */
+#define JSON_STREAM_GEN_END_RESUMABLE_GENERATOR_FUNC() \
+    break; \
+    } \
+    return (json_stream_gen_callback_result_t) \
+    { \
+        .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_FINISH, \
+    }
+
 #define JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(func_name, ...) json_stream_gen_callback_result_t func_name(__VA_ARGS__)
 
 #define JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC() \
@@ -221,6 +437,29 @@ json_stream_gen_inc_stage_internal(json_stream_gen_t* const p_gen);
         } \
     } while (0)
 
+/**
+ * @brief Macro to call a JSON generator sub-function which is skipped after it has been completed.
+ * @details If cfg.sub_func_cache_size is not zero, then the number of steps consumed by the completed sub-function
+ * is remembered, and the sub-function is not called again while the following chunks are generated.
+ * @note The sub-function must not have any side effects other than generating JSON.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param func_name is the name of the sub-function, the rest of the arguments are passed to it.
+ */
+#define JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, func_name, ...) \
+    do \
+    { \
+        const int32_t jsg_sub_func_start_step = json_stream_gen_begin_sub_func_internal(p_gen); \
+        if (jsg_sub_func_start_step >= 0) \
+        { \
+            const json_stream_gen_callback_result_t jsg_sub_func_res = func_name(__VA_ARGS__); \
+            if (JSON_STREAM_GEN_CALLBACK_RESULT_FINISH != jsg_sub_func_res.cb_res) \
+            { \
+                return jsg_sub_func_res; \
+            } \
+            json_stream_gen_end_sub_func_internal(p_gen, jsg_sub_func_start_step); \
+        } \
+    } while (0)
+
 /**
  * @brief Macro to start a new JSON object.
  * @note This macro should be used only inside a JSON generator callback function.
@@ -427,6 +666,94 @@ json_stream_gen_inc_stage_internal(json_stream_gen_t* const p_gen);
         } \
     } while (0)
 
+/**
+ * @brief Macro to add a new JSON string with the given length to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON string.
+ * @param p_val is a pointer to the value of the new JSON string (it does not need to be null-terminated).
+ * @param len is the length of the value.
+ */
+#define JSON_STREAM_GEN_ADD_STRING_N(p_gen, key, p_val, len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_string_n(p_gen, key, p_val, len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON string with the given length to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_val is a pointer to the value of the new JSON string (it does not need to be null-terminated).
+ * @param len is the length of the value.
+ */
+#define JSON_STREAM_GEN_ADD_STRING_N_TO_ARRAY(p_gen, p_val, len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_string_n(p_gen, NULL, p_val, len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new raw JSON string with the given length to an existing JSON object.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new raw JSON string.
+ * @param p_val is a pointer to the value of the new raw JSON string (it does not need to be null-terminated).
+ * @param len is the length of the value.
+ */
+#define JSON_STREAM_GEN_ADD_RAW_STRING_N(p_gen, key, p_val, len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_raw_string_n(p_gen, key, p_val, len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new raw JSON string with the given length to an existing JSON array.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_val is a pointer to the value of the new raw JSON string (it does not need to be null-terminated).
+ * @param len is the length of the value.
+ */
+#define JSON_STREAM_GEN_ADD_RAW_STRING_N_TO_ARRAY(p_gen, p_val, len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_raw_string_n(p_gen, NULL, p_val, len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
 /**
  * @brief Macro to add a new JSON int32 to an existing JSON object.
  * @note This macro should be used only inside a JSON generator callback function.
@@ -1098,6 +1425,66 @@ typedef enum json_stream_gen_num_decimals_double_e
         } \
     } while (0)
 
+#define JSON_STREAM_GEN_INT32_SCALED_MAX_NUM_DECIMALS (9) ///< The maximum number of decimals of a scaled int32.
+
+/**
+ * @def JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, key, raw, num_decimals)
+ *
+ * @brief A macro that adds a fixed-point number given as a scaled integer to the JSON stream,
+ * e.g. raw=2345 with num_decimals=2 is added as 23.45.
+ *
+ * @note This macro is a part of the generator's state machine. It checks the current generator stage,
+ * and if the stage matches, it calls the function to add the number to the JSON stream.
+ * It is expected to be used inside the main JSON generation function, that controls the generation flow.
+ *
+ * @param p_gen         Pointer to the JSON stream generator.
+ * @param key           Key of the JSON item.
+ * @param raw           The value multiplied by 10^num_decimals.
+ * @param num_decimals  Number of decimal places (0..JSON_STREAM_GEN_INT32_SCALED_MAX_NUM_DECIMALS).
+ */
+#define JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, key, raw, num_decimals) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_int32_scaled(p_gen, key, raw, num_decimals)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @def JSON_STREAM_GEN_ADD_INT32_SCALED_TO_ARRAY(p_gen, raw, num_decimals)
+ *
+ * @brief A macro that adds a fixed-point number given as a scaled integer to a JSON array in the stream.
+ *
+ * @note This macro is a part of the generator's state machine. It checks the current generator stage,
+ * and if the stage matches, it calls the function to add the number to the JSON array.
+ * It is expected to be used inside the main JSON generation function, that controls the generation flow.
+ *
+ * @param p_gen         Pointer to the JSON stream generator.
+ * @param raw           The value multiplied by 10^num_decimals.
+ * @param num_decimals  Number of decimal places (0..JSON_STREAM_GEN_INT32_SCALED_MAX_NUM_DECIMALS).
+ */
+#define JSON_STREAM_GEN_ADD_INT32_SCALED_TO_ARRAY(p_gen, raw, num_decimals) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_int32_scaled(p_gen, NULL, raw, num_decimals)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
 /**
  * @brief A macro that adds a hexadecimal buffer to the JSON stream.
  *
@@ -1152,24 +1539,581 @@ typedef enum json_stream_gen_num_decimals_double_e
     } while (0)
 
 /**
- * @brief Function that must be called at the beginning of a JSON generator callback function.
+ * @brief A macro that adds a buffer encoded in Base64 (RFC 4648, with padding) to the JSON stream.
+ *
+ * This macro is a part of the generator's state machine. It checks the current generator stage,
+ * and if the stage matches, it calls the function to add the Base64-encoded buffer to the JSON stream.
+ * It is expected to be used inside the main JSON generation function, that controls the generation flow.
+ *
+ * @param p_gen   Pointer to the JSON stream generator.
+ * @param key     Key of the JSON item.
+ * @param p_buf   Pointer to the buffer to be added.
+ * @param buf_len Length of the buffer.
  */
-void
-json_stream_gen_begin_generator_func(json_stream_gen_t* const p_gen);
+#define JSON_STREAM_GEN_ADD_BASE64(p_gen, key, p_buf, buf_len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_base64(p_gen, key, p_buf, buf_len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
 
 /**
- * @brief Starts a new sub-object. If a name is provided, the object is added as a member to the current object,
- * otherwise, it is added as an unnamed object to the current array.
- * @details The function fails if the current nesting level has reached the configured maximum.
- * @param p_gen A pointer to the JSON stream generator.
- * @param p_name The name of the object. Can be NULL for unnamed objects (e.g., in arrays).
- * @return Returns true if the sub-object was started successfully; otherwise, it returns false.
+ * @brief A macro that adds a buffer encoded in Base64 (RFC 4648, with padding) to a JSON array in the stream.
+ *
+ * @param p_gen   Pointer to the JSON stream generator.
+ * @param p_buf   Pointer to the buffer to be added.
+ * @param buf_len Length of the buffer.
  */
-bool
-json_stream_gen_start_object(json_stream_gen_t* const p_gen, const char* const p_name);
-
-/**
- * @brief Ends the last started sub-object.
+#define JSON_STREAM_GEN_ADD_BASE64_TO_ARRAY(p_gen, p_buf, buf_len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_base64(p_gen, NULL, p_buf, buf_len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief A macro that adds a buffer encoded in Base64url (RFC 4648, URL-safe alphabet, without padding)
+ * to the JSON stream.
+ *
+ * @param p_gen   Pointer to the JSON stream generator.
+ * @param key     Key of the JSON item.
+ * @param p_buf   Pointer to the buffer to be added.
+ * @param buf_len Length of the buffer.
+ */
+#define JSON_STREAM_GEN_ADD_BASE64URL(p_gen, key, p_buf, buf_len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_base64url(p_gen, key, p_buf, buf_len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief A macro that adds a buffer encoded in Base64url (RFC 4648, URL-safe alphabet, without padding)
+ * to a JSON array in the stream.
+ *
+ * @param p_gen   Pointer to the JSON stream generator.
+ * @param p_buf   Pointer to the buffer to be added.
+ * @param buf_len Length of the buffer.
+ */
+#define JSON_STREAM_GEN_ADD_BASE64URL_TO_ARRAY(p_gen, p_buf, buf_len) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_base64url(p_gen, NULL, p_buf, buf_len)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief A macro that adds a timestamp in ISO 8601 format ("YYYY-MM-DDThh:mm:ss.sssZ") to the JSON stream.
+ *
+ * @param p_gen    Pointer to the JSON stream generator.
+ * @param key      Key of the JSON item.
+ * @param epoch_ms The number of milliseconds since 1970-01-01T00:00:00Z.
+ */
+#define JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, key, epoch_ms) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_timestamp_iso8601(p_gen, key, epoch_ms)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief A macro that adds a timestamp in ISO 8601 format ("YYYY-MM-DDThh:mm:ss.sssZ") to a JSON array in the stream.
+ *
+ * @param p_gen    Pointer to the JSON stream generator.
+ * @param epoch_ms The number of milliseconds since 1970-01-01T00:00:00Z.
+ */
+#define JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601_TO_ARRAY(p_gen, epoch_ms) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_timestamp_iso8601(p_gen, NULL, epoch_ms)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief A macro that adds a timestamp as the number of milliseconds since the Unix epoch to the JSON stream.
+ *
+ * @param p_gen    Pointer to the JSON stream generator.
+ * @param key      Key of the JSON item.
+ * @param epoch_ms The number of milliseconds since 1970-01-01T00:00:00Z.
+ */
+#define JSON_STREAM_GEN_ADD_TIMESTAMP_EPOCH_MS(p_gen, key, epoch_ms) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_timestamp_epoch_ms(p_gen, key, epoch_ms)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief A macro that adds a timestamp as the number of milliseconds since the Unix epoch to a JSON array
+ * in the stream.
+ *
+ * @param p_gen    Pointer to the JSON stream generator.
+ * @param epoch_ms The number of milliseconds since 1970-01-01T00:00:00Z.
+ */
+#define JSON_STREAM_GEN_ADD_TIMESTAMP_EPOCH_MS_TO_ARRAY(p_gen, epoch_ms) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_timestamp_epoch_ms(p_gen, NULL, epoch_ms)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of int32 values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of int32 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_INT32_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_int32_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of int32 values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of int32 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_INT32_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_int32_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of uint32 values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of uint32 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_UINT32_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_uint32_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of uint32 values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of uint32 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_UINT32_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_uint32_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of int64 values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of int64 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_INT64_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_int64_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of int64 values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of int64 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_INT64_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_int64_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of uint64 values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of uint64 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_UINT64_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_uint64_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of uint64 values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of uint64 values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_UINT64_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_uint64_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of float values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of float values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_FLOAT_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_float_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of float values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of float values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_FLOAT_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_float_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of double values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of double values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_DOUBLE_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_double_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of double values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of double values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_DOUBLE_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_double_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of bool values to an existing JSON object.
+ * @note This macro should be used only inside a JSON generator callback function.
+ *       The whole array occupies a single stage, the position of the next element to emit is kept
+ *       in the generator, so the array can span several chunks without re-walking the emitted elements.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the key of the new JSON array.
+ * @param p_arr is a pointer to the array of bool values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_BOOL_ARRAY(p_gen, key, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_bool_array(p_gen, key, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array of bool values to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param p_arr is a pointer to the array of bool values.
+ * @param count is the number of elements in the array.
+ */
+#define JSON_STREAM_GEN_ADD_BOOL_ARRAY_TO_ARRAY(p_gen, p_arr, count) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_bool_array(p_gen, NULL, p_arr, count)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array with elements provided by an iterator callback.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param key is the name of the new JSON array.
+ * @param cb_next is the iterator callback which adds the array elements.
+ * @param p_iter_ctx is a pointer to user-defined iterator data passed to the callback.
+ */
+#define JSON_STREAM_GEN_ADD_ARRAY_FROM_ITERATOR(p_gen, key, cb_next, p_iter_ctx) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_array_from_iterator(p_gen, key, cb_next, p_iter_ctx)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Macro to add a new JSON array with elements provided by an iterator callback to an existing JSON array.
+ * @note This macro should be used only inside a JSON generator callback function.
+ * @param p_gen is a pointer to a json_stream_gen_t instance.
+ * @param cb_next is the iterator callback which adds the array elements.
+ * @param p_iter_ctx is a pointer to user-defined iterator data passed to the callback.
+ */
+#define JSON_STREAM_GEN_ADD_ARRAY_FROM_ITERATOR_TO_ARRAY(p_gen, cb_next, p_iter_ctx) \
+    do \
+    { \
+        if (json_stream_gen_check_stage_internal(p_gen)) \
+        { \
+            if (!json_stream_gen_add_array_from_iterator(p_gen, NULL, cb_next, p_iter_ctx)) \
+            { \
+                return (json_stream_gen_callback_result_t) { \
+                    .cb_res = JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW, \
+                }; \
+            } \
+            json_stream_gen_inc_stage_internal(p_gen); \
+        } \
+    } while (0)
+
+/**
+ * @brief Function that must be called at the beginning of a JSON generator callback function.
+ */
+void
+json_stream_gen_begin_generator_func(json_stream_gen_t* const p_gen);
+
+/**
+ * @brief Starts a new sub-object. If a name is provided, the object is added as a member to the current object,
+ * otherwise, it is added as an unnamed object to the current array.
+ * @details The function fails if the current nesting level has reached the configured maximum.
+ * @param p_gen A pointer to the JSON stream generator.
+ * @param p_name The name of the object. Can be NULL for unnamed objects (e.g., in arrays).
+ * @return Returns true if the sub-object was started successfully; otherwise, it returns false.
+ */
+bool
+json_stream_gen_start_object(json_stream_gen_t* const p_gen, const char* const p_name);
+
+/**
+ * @brief Ends the last started sub-object.
  * @details The function fails if there are no started objects left to end.
  * @param p_gen A pointer to the JSON stream generator.
  * @return Returns true if the object was ended successfully; otherwise, it returns false.
@@ -1220,6 +2164,41 @@ json_stream_gen_add_string(json_stream_gen_t* const p_gen, const char* const p_n
 bool
 json_stream_gen_add_raw_string(json_stream_gen_t* const p_gen, const char* const p_name, const char* const p_val);
 
+/**
+ * @brief Adds a JSON string with the given length.
+ * @details The same as json_stream_gen_add_string, but the value does not need to be null-terminated,
+ * so the strings from fixed-size fields and network buffers can be added without copying them.
+ * The null characters inside the value are escaped.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the string to be added. If this is NULL, the string is added without a name (into an array).
+ * @param p_val Value of the string to be added. If this is NULL, a null is added.
+ * @param len Length of the value.
+ * @return Returns true if the string was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_string_n(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const char* const        p_val,
+    const size_t             len);
+
+/**
+ * @brief Adds a raw JSON string with the given length.
+ * @details The same as json_stream_gen_add_raw_string, but the value does not need to be null-terminated.
+ * The value must not contain null characters.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the string to be added. If this is NULL, the string is added without a name (into an array).
+ * @param p_val Value of the string to be added. If this is NULL, a null is added.
+ * @param len Length of the value.
+ * @return Returns true if the string was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_raw_string_n(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const char* const        p_val,
+    const size_t             len);
+
 /**
  * @brief Adds a 32-bit integer to the JSON stream.
  * @details This function adds a 32-bit integer to the JSON stream.
@@ -1297,7 +2276,8 @@ json_stream_gen_add_null(json_stream_gen_t* const p_gen, const char* const p_nam
  * @param p_gen          The JSON stream generator instance.
  * @param p_name         The key string of the value to be added.
  * @param val            The float value to be added.
- * @param precision      The precision of the float value.
+ * @param precision      The precision of the float value,
+ *                       or -1 to print the shortest digits which are converted back to the same value.
  *
  * @return true if the float value was successfully added, false otherwise.
  */
@@ -1314,7 +2294,8 @@ json_stream_gen_add_float(
  * @param p_gen          The JSON stream generator instance.
  * @param p_name         The key string of the value to be added.
  * @param val            The double value to be added.
- * @param precision      The precision of the double value.
+ * @param precision      The precision of the double value,
+ *                       or -1 to print the shortest digits which are converted back to the same value.
  *
  * @return true if the double value was successfully added, false otherwise.
  */
@@ -1401,6 +2382,27 @@ json_stream_gen_add_double_limited_fixed_point(
     const double_t                        val,
     json_stream_gen_num_decimals_double_e num_decimals);
 
+/**
+ * @brief Adds a fixed-point number given as a scaled integer to the JSON stream.
+ *
+ * The number is printed with integer arithmetic only, so it's exact and does not need an FPU,
+ * e.g. raw=2345 with num_decimals=2 is added as 23.45, raw=-5 with num_decimals=3 is added as -0.005.
+ * If num_decimals is out of range, it adds a null.
+ *
+ * @param p_gen         Pointer to the JSON stream generator.
+ * @param p_name        Name of the JSON item.
+ * @param raw           The value multiplied by 10^num_decimals.
+ * @param num_decimals  Number of decimal places (0..JSON_STREAM_GEN_INT32_SCALED_MAX_NUM_DECIMALS).
+ *
+ * @return true if the number was successfully added, false otherwise.
+ */
+bool
+json_stream_gen_add_int32_scaled(
+    json_stream_gen_t* const             p_gen,
+    const char* const                    p_name,
+    const int32_t                        raw,
+    const json_stream_gen_num_decimals_t num_decimals);
+
 /**
  * @brief Adds a hexadecimal buffer to the JSON stream.
  *
@@ -1422,6 +2424,221 @@ json_stream_gen_add_hex_buf(
     const uint8_t* const     p_buf,
     size_t                   buf_len);
 
+/**
+ * @brief Adds a buffer encoded in Base64 to the JSON stream.
+ *
+ * This function adds a binary buffer to the JSON stream, where the buffer is represented as a Base64 string
+ * (RFC 4648, the standard alphabet with '=' padding), which is a third shorter than the hexadecimal representation.
+ * If the buffer cannot be added due to size limitations, it resets the generator state to the state before the
+ * function call.
+ *
+ * @param p_gen   Pointer to the JSON stream generator.
+ * @param p_name  Name of the JSON item.
+ * @param p_buf   Pointer to the buffer to be added.
+ * @param buf_len Length of the buffer.
+ *
+ * @return true if the buffer was successfully added, false otherwise.
+ */
+bool
+json_stream_gen_add_base64(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len);
+
+/**
+ * @brief Adds a buffer encoded in Base64url to the JSON stream.
+ *
+ * The same as json_stream_gen_add_base64, but the URL and filename safe alphabet is used ('-' and '_' instead of
+ * '+' and '/'), and the padding is omitted.
+ *
+ * @param p_gen   Pointer to the JSON stream generator.
+ * @param p_name  Name of the JSON item.
+ * @param p_buf   Pointer to the buffer to be added.
+ * @param buf_len Length of the buffer.
+ *
+ * @return true if the buffer was successfully added, false otherwise.
+ */
+bool
+json_stream_gen_add_base64url(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len);
+
+/**
+ * @brief Adds a timestamp in ISO 8601 format to the JSON stream.
+ * @details The timestamp is added as a string in UTC with milliseconds: "YYYY-MM-DDThh:mm:ss.sssZ".
+ * If the timestamp is outside the years 0000..9999, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the timestamp to be added. If this is `NULL`, the timestamp is added without a name (into an
+ * array).
+ * @param epoch_ms The number of milliseconds since 1970-01-01T00:00:00Z.
+ * @return Returns `true` if the value was successfully added to the JSON stream; otherwise, returns `false`.
+ */
+bool
+json_stream_gen_add_timestamp_iso8601(json_stream_gen_t* const p_gen, const char* const p_name, const int64_t epoch_ms);
+
+/**
+ * @brief Adds a timestamp as the number of milliseconds since the Unix epoch to the JSON stream.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the timestamp to be added. If this is `NULL`, the timestamp is added without a name (into an
+ * array).
+ * @param epoch_ms The number of milliseconds since 1970-01-01T00:00:00Z.
+ * @return Returns `true` if the value was successfully added to the JSON stream; otherwise, returns `false`.
+ */
+bool
+json_stream_gen_add_timestamp_epoch_ms(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const int64_t            epoch_ms);
+
+/**
+ * @brief Adds a JSON array of int32 values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of int32 values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_int32_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const int32_t* const     p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array of uint32 values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of uint32 values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_uint32_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint32_t* const    p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array of int64 values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of int64 values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_int64_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const int64_t* const     p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array of uint64 values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of uint64 values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_uint64_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint64_t* const    p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array of float values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of float values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_float_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const float* const       p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array of double values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of double values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_double_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const double* const      p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array of bool values.
+ * @details The array is emitted element by element, if the chunk overflows, the index of the next element
+ * is saved in the generator and the emission continues from this element on the next call.
+ * If p_arr is NULL, it adds a null.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param p_arr Pointer to the array of bool values.
+ * @param count Number of elements in the array.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_bool_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const bool* const        p_arr,
+    const size_t             count);
+
+/**
+ * @brief Adds a JSON array with elements provided by an iterator callback.
+ * @details The iterator callback is called with increasing indexes until it returns JSON_STREAM_GEN_ITER_RESULT_END,
+ * if the chunk overflows, the index of the element which did not fit is saved in the generator and the emission
+ * continues from this element on the next call, so the elements which were added in the previous chunks
+ * are not requested again (the index following the last element can be requested more than once).
+ * @note The iterator callback must not add arrays with json_stream_gen_add_*_array functions.
+ * @param p_gen Pointer to the JSON stream generator.
+ * @param p_name Name of the array to be added. If this is NULL, the array is added without a name (into an array).
+ * @param cb_next The iterator callback which adds the array elements.
+ * @param p_iter_ctx Pointer to user-defined iterator data passed to the callback.
+ * @return Returns true if the whole array was added successfully; otherwise, returns false.
+ */
+bool
+json_stream_gen_add_array_from_iterator(
+    json_stream_gen_t* const             p_gen,
+    const char* const                    p_name,
+    const json_stream_gen_cb_iter_next_t cb_next,
+    void* const                          p_iter_ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,280 @@
+/**
+ * @file json_stream_gen_coro.hpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ *
+ * @brief Optional C++20 front-end for json_stream_gen, where a generator is written as a coroutine.
+ *  Every item is passed to co_yield as a callable which adds the item to the chunk. If the item does not fit
+ *  into the chunk, the coroutine is suspended, and the item is added again at the beginning of the next chunk,
+ *  after that the coroutine continues from the point where it was suspended.
+ *  Unlike the callbacks based on JSON_STREAM_GEN_* macros, the items generated in the previous chunks are not
+ *  re-walked, so ordinary loops, branches and local variables can be used without the stage bookkeeping.
+ *
+ * @code
+ * json_stream_gen::Coroutine
+ * generate_json(json_stream_gen_t* const p_gen, const user_data_t* const p_data)
+ * {
+ *     co_yield json_stream_gen::item(&json_stream_gen_add_string, p_gen, "name", p_data->name);
+ *     co_yield json_stream_gen::item(&json_stream_gen_start_array, p_gen, "values");
+ *     for (uint32_t i = 0; i < p_data->num_values; ++i)
+ *     {
+ *         co_yield [=] { return json_stream_gen_add_int32(p_gen, nullptr, p_data->values[i]); };
+ *     }
+ *     co_yield json_stream_gen::item(&json_stream_gen_end_array, p_gen);
+ * }
+ *
+ * json_stream_gen::CoroGenerator gen(&cfg, [p_data](json_stream_gen_t* const p_gen) {
+ *     return generate_json(p_gen, p_data);
+ * });
+ * const char* p_chunk = json_stream_gen_get_next_chunk(gen.get());
+ * @endcode
+ *
+ * @note json_stream_gen_save_state and json_stream_gen_restore_state are not supported for the coroutines,
+ *  since the frame of the coroutine can't be saved. json_stream_gen_reset and json_stream_gen_seek restart
+ *  the coroutine from the beginning.
+ */
+
+#ifndef JSON_STREAM_GEN_CORO_HPP
+#define JSON_STREAM_GEN_CORO_HPP
+
+#include <coroutine>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "json_stream_gen.h"
+
+namespace json_stream_gen
+{
+
+/**
+ * @brief The return type of a JSON generator coroutine.
+ */
+class Coroutine
+{
+public:
+    class promise_type
+    {
+    public:
+        Coroutine
+        get_return_object()
+        {
+            return Coroutine(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always
+        initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always
+        final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void
+        return_void() noexcept
+        {
+        }
+
+        void
+        unhandled_exception() noexcept
+        {
+            // The coroutine is resumed from the C code, so the exception can't be propagated to the caller.
+            std::terminate();
+        }
+
+        /**
+         * @brief Adds the item to the chunk, the coroutine is suspended only if the item does not fit into it.
+         * @details The callable is a temporary of the co_yield expression, so it lives in the frame of the coroutine
+         * until the coroutine is resumed, and it can be called again without copying it.
+         */
+        template<typename T>
+        std::suspend_always
+        yield_value(T&& item)
+        {
+            m_p_pending_item = const_cast<void*>(static_cast<const void*>(std::addressof(item)));
+            m_p_add_item     = [](void* const p_item) -> bool {
+                return (*static_cast<std::remove_reference_t<T>*>(p_item))();
+            };
+            return {};
+        }
+
+        /**
+         * @brief Adds the item which was passed to the last co_yield.
+         * @return Returns false if the item does not fit into the chunk.
+         */
+        bool
+        add_pending_item()
+        {
+            if (nullptr == m_p_pending_item)
+            {
+                return true;
+            }
+            if (!m_p_add_item(m_p_pending_item))
+            {
+                return false;
+            }
+            m_p_pending_item = nullptr;
+            return true;
+        }
+
+    private:
+        void* m_p_pending_item = nullptr;
+        bool (*m_p_add_item)(void* p_item) = nullptr;
+    };
+
+    Coroutine() = default;
+
+    explicit Coroutine(const std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    ~Coroutine()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+    Coroutine(const Coroutine&) = delete;
+    Coroutine&
+    operator=(const Coroutine&)
+        = delete;
+
+    Coroutine(Coroutine&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    Coroutine&
+    operator=(Coroutine&& other) noexcept
+    {
+        if (&other != this)
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Continues the coroutine until the next item does not fit into the chunk.
+     * @return Returns JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW if the chunk is full
+     * or JSON_STREAM_GEN_CALLBACK_RESULT_FINISH if the coroutine has finished.
+     */
+    json_stream_gen_callback_result_t
+    resume()
+    {
+        promise_type& promise = m_handle.promise();
+        while (!m_handle.done())
+        {
+            if (!promise.add_pending_item())
+            {
+                return json_stream_gen_callback_result_t { JSON_STREAM_GEN_CALLBACK_RESULT_OVERFLOW };
+            }
+            m_handle.resume();
+        }
+        return json_stream_gen_callback_result_t { JSON_STREAM_GEN_CALLBACK_RESULT_FINISH };
+    }
+
+private:
+    std::coroutine_handle<promise_type> m_handle = nullptr;
+};
+
+/**
+ * @brief Makes a callable for co_yield which calls one of json_stream_gen_add_* functions with the given arguments.
+ */
+template<typename Func, typename... Args>
+auto
+item(Func func, Args... args)
+{
+    return [func, args = std::make_tuple(args...)]() -> bool { return std::apply(func, args); };
+}
+
+/**
+ * @brief Owns a json_stream_gen_t instance, which chunks are generated by a coroutine.
+ */
+class CoroGenerator
+{
+public:
+    using factory_t = std::function<Coroutine(json_stream_gen_t* p_gen)>;
+
+    CoroGenerator(const json_stream_gen_cfg_t* const p_cfg, factory_t factory)
+        : m_p_state(std::make_unique<State>())
+    {
+        m_p_state->factory = std::move(factory);
+        void* p_ctx        = nullptr;
+        m_p_gen            = json_stream_gen_create(p_cfg, &cb_generate_next, sizeof(State*), &p_ctx);
+        if (nullptr == m_p_gen)
+        {
+            throw std::runtime_error("json_stream_gen_create failed");
+        }
+        State* const p_state = m_p_state.get();
+        std::memcpy(p_ctx, &p_state, sizeof(p_state));
+    }
+
+    ~CoroGenerator()
+    {
+        if (nullptr != m_p_gen)
+        {
+            json_stream_gen_delete(&m_p_gen);
+        }
+    }
+
+    CoroGenerator(const CoroGenerator&) = delete;
+    CoroGenerator&
+    operator=(const CoroGenerator&)
+        = delete;
+    CoroGenerator(CoroGenerator&&) = delete;
+    CoroGenerator&
+    operator=(CoroGenerator&&)
+        = delete;
+
+    json_stream_gen_t*
+    get() const
+    {
+        return m_p_gen;
+    }
+
+private:
+    struct State
+    {
+        factory_t factory;
+        Coroutine coroutine;
+    };
+
+    static json_stream_gen_callback_result_t
+    cb_generate_next(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+    {
+        State* p_state = nullptr;
+        std::memcpy(&p_state, p_user_ctx, sizeof(p_state));
+        // The stages are not used by the coroutines, so the first stage means that the generator has been reset,
+        // and the coroutine should be started from the beginning.
+        json_stream_gen_begin_generator_func(p_gen);
+        if (json_stream_gen_check_stage_internal(p_gen))
+        {
+            p_state->coroutine = p_state->factory(p_gen);
+            json_stream_gen_inc_stage_internal(p_gen);
+        }
+        return p_state->coroutine.resume();
+    }
+
+    std::unique_ptr<State> m_p_state;
+    json_stream_gen_t*     m_p_gen = nullptr;
+};
+
+} // namespace json_stream_gen
+
+#endif // JSON_STREAM_GEN_CORO_HPP
@@ -7,25 +7,43 @@
 
 #include "json_stream_gen.h"
 #include <stdio.h>
-#include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
-#include <inttypes.h>
 #include <math.h>
 #include <float.h>
 #include <locale.h>
 
+#if !defined(JSON_STREAM_GEN_DISABLE_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define JSG_SIMD_AVX2 (1)
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define JSG_SIMD_SSE2 (1)
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define JSG_SIMD_NEON (1)
+#endif
+#endif
+
+#define JSON_STREAM_GEN_STR_BUF_SIZE_INT    (20U) ///< The number of digits in UINT64_MAX.
 #define JSON_STREAM_GEN_STR_BUF_SIZE_FLOAT  (16U)
 #define JSON_STREAM_GEN_STR_BUF_SIZE_DOUBLE (30U)
 
-#define JSON_STREAM_GEN_STR_BUF_SIZE_LIMITED_FLOAT  (13U)
-#define JSON_STREAM_GEN_STR_BUF_SIZE_LIMITED_DOUBLE (22U)
+#define JSON_STREAM_GEN_STR_BUF_SIZE_FIXED_POINT      (21U) ///< The sign, 16 significant digits and 4 zeros.
+#define JSON_STREAM_GEN_LIMITED_FLOAT_MAX_NUM_ZEROS  (3U)
+#define JSON_STREAM_GEN_LIMITED_DOUBLE_MAX_NUM_ZEROS (4U)
 
-#define JSON_STREAM_GEN_CONST_U32_10    (10U)
-#define JSON_STREAM_GEN_CONST_FLOAT_10  (10.0f)
-#define JSON_STREAM_GEN_CONST_DOUBLE_10 (10.0)
-#define JSON_STREAM_GEN_CONST_FLOAT_1   (1.0f)
-#define JSON_STREAM_GEN_CONST_DOUBLE_1  (1.0)
+#define JSON_STREAM_GEN_CONST_U32_10        (10U)
+#define JSON_STREAM_GEN_CONST_U32_100       (100U)
+#define JSON_STREAM_GEN_CONST_U32_100000000 (100000000U)
+#define JSON_STREAM_GEN_CONST_FLOAT_10      (10.0f)
+#define JSON_STREAM_GEN_CONST_DOUBLE_10     (10.0)
+#define JSON_STREAM_GEN_CONST_FLOAT_1       (1.0f)
+#define JSON_STREAM_GEN_CONST_DOUBLE_1      (1.0)
 
 typedef enum json_stream_gen_state_e
 {
@@ -37,6 +55,20 @@ typedef enum json_stream_gen_state_e
     JSON_STREAM_GEN_STATE_ERROR,
 } json_stream_gen_state_e;
 
+typedef enum jsg_spill_state_e
+{
+    JSG_SPILL_STATE_NONE,    ///< The spill buffer is empty.
+    JSG_SPILL_STATE_ACTIVE,  ///< The current item is being rendered into the spill buffer.
+    JSG_SPILL_STATE_PENDING, ///< The spill buffer contains a complete item which must be flushed to the next chunk.
+} jsg_spill_state_e;
+
+typedef struct jsg_sub_func_record_t
+{
+    int32_t  start_step;
+    int32_t  num_steps;
+    uint32_t depth; ///< The nesting depth of the sub-generator call, the nested ones can start at the same step.
+} jsg_sub_func_record_t;
+
 struct json_stream_gen_t
 {
     json_stream_gen_cb_generate_next_t cb_gen_next;
@@ -45,16 +77,63 @@ struct json_stream_gen_t
     char*                              p_chunk_buf;
     size_t                             chunk_buf_idx;
     uint32_t                           cur_nesting_level;
-    char*                              p_indent_filling;
+    char*                              p_separators;
     bool                               flag_new_data_added;
     int32_t                            json_stream_gen_step;
     int32_t                            json_stream_gen_stage;
+    int32_t                            resume_point;
+    int32_t                            resume_step;
     json_stream_gen_state_e            json_gen_state;
     bool                               is_first_item;
-    const char*                        p_eol;
-    char                               p_delimiter[2];
+    bool                               is_array_started;
+    size_t                             array_elem_idx;
+    bool                               is_value_split;
+    size_t                             value_offset;
+    jsg_sub_func_record_t*             p_sub_func_records;
+    uint32_t                           num_sub_func_records;
+    uint32_t                           sub_func_record_idx;
+    uint32_t                           sub_func_depth;
+    char*                              p_spill_buf;
+    size_t                             spill_buf_size;
+    size_t                             spill_len;
+    jsg_spill_state_e                  spill_state;
+    bool                               is_counting_only;
+    size_t                             seek_offset;
+    size_t                             skip_len;
+    size_t                             eol_len;
+    size_t                             indent_step;
+    char                               key_suffix[3]; ///< '":' followed by the delimiter in the formatted JSON.
+    size_t                             key_suffix_len;
+    const char*                        p_literal_key;   ///< The key passed with JSON_STREAM_GEN_KEY.
+    size_t                             literal_key_len; ///< The length of p_literal_key known at compile time.
+    char                               decimal_point;
 };
 
+#define JSG_SAVED_STATE_MAGIC (0x4A534753U)
+
+/**
+ * @brief The resumable state of the generator, which is saved by json_stream_gen_save_state.
+ * @note The pending bytes of the spill buffer follow this structure in the saved blob.
+ */
+typedef struct jsg_saved_state_t
+{
+    uint32_t                magic;
+    int32_t                 json_stream_gen_step;
+    int32_t                 json_stream_gen_stage;
+    int32_t                 resume_point;
+    int32_t                 resume_step;
+    uint32_t                cur_nesting_level;
+    json_stream_gen_state_e json_gen_state;
+    jsg_spill_state_e       spill_state;
+    uint8_t                 is_first_item; ///< The bools are saved as bytes to be able to validate them on restoring.
+    uint8_t                 is_array_started;
+    uint8_t                 is_value_split;
+    size_t                  array_elem_idx;
+    size_t                  value_offset;
+    size_t                  skip_len;
+    size_t                  spill_len;
+} jsg_saved_state_t;
+
 /**
  * @brief typedef for basic 'int' type
  *
@@ -70,6 +149,8 @@ void
 json_stream_gen_begin_generator_func(json_stream_gen_t* const p_gen)
 {
     p_gen->json_stream_gen_step = 0;
+    p_gen->sub_func_record_idx  = 0;
+    p_gen->sub_func_depth       = 0;
 }
 
 static void
@@ -79,7 +160,10 @@ jsg_copy_non_zero_cfg_fields(json_stream_gen_cfg_t* const p_dst, const json_stre
     {
         p_dst->max_chunk_size = p_src->max_chunk_size;
     }
-    p_dst->flag_formatted_json = p_src->flag_formatted_json;
+    p_dst->flag_formatted_json    = p_src->flag_formatted_json;
+    p_dst->flag_split_long_values = p_src->flag_split_long_values;
+    p_dst->flag_pack_chunks       = p_src->flag_pack_chunks;
+    p_dst->flag_hex_lowercase     = p_src->flag_hex_lowercase;
     if (0 != p_src->max_nesting_level)
     {
         p_dst->max_nesting_level = p_src->max_nesting_level;
@@ -104,6 +188,25 @@ jsg_copy_non_zero_cfg_fields(json_stream_gen_cfg_t* const p_dst, const json_stre
     {
         p_dst->p_localeconv = p_src->p_localeconv;
     }
+    if (0 != p_src->sub_func_cache_size)
+    {
+        p_dst->sub_func_cache_size = p_src->sub_func_cache_size;
+    }
+    if (0 != p_src->spill_buf_size)
+    {
+        p_dst->spill_buf_size = p_src->spill_buf_size;
+    }
+}
+
+static char
+jsg_get_decimal_point(const json_stream_gen_cfg_t* const p_cfg)
+{
+    const struct lconv* const p_lc = p_cfg->p_localeconv();
+    if ((NULL == p_lc) || (NULL == p_lc->decimal_point) || ('\0' == *p_lc->decimal_point))
+    {
+        return '.';
+    }
+    return *p_lc->decimal_point;
 }
 
 json_stream_gen_t*
@@ -126,18 +229,30 @@ json_stream_gen_create(
     {
         return NULL;
     }
+    if (cfg.flag_pack_chunks || (cfg.spill_buf_size > cfg.max_chunk_size))
+    {
+        // The spilled item is flushed to the next chunk, so it can't be larger than the chunk.
+        // If the chunks are packed, then the spill buffer holds the part of the item carried over to the next chunk.
+        cfg.spill_buf_size = cfg.max_chunk_size;
+    }
+    if (cfg.spill_buf_size < 0)
+    {
+        cfg.spill_buf_size = 0;
+    }
 
     size_t mem_size = sizeof(json_stream_gen_t);
+    mem_size += cfg.sub_func_cache_size * sizeof(jsg_sub_func_record_t);
     mem_size += ctx_size;
     mem_size += cfg.max_chunk_size;
     if (cfg.flag_formatted_json)
     {
-        mem_size += (cfg.max_nesting_level * cfg.indentation) + 1;
+        mem_size += (cfg.max_nesting_level * cfg.indentation) + 2;
     }
     else
     {
         mem_size += 1;
     }
+    mem_size += (size_t)cfg.spill_buf_size;
     json_stream_gen_t* const p_gen = cfg.p_malloc(mem_size);
     if (NULL == p_gen)
     {
@@ -146,28 +261,39 @@ json_stream_gen_create(
     memset(p_gen, 0, mem_size);
     p_gen->cfg         = cfg;
     p_gen->cb_gen_next = cb_gen_next;
-    p_gen->p_ctx       = (char*)p_gen + sizeof(*p_gen);
-    p_gen->p_chunk_buf = (char*)p_gen->p_ctx + ctx_size;
+    p_gen->p_sub_func_records = (jsg_sub_func_record_t*)((char*)p_gen + sizeof(*p_gen));
+    p_gen->p_ctx              = &p_gen->p_sub_func_records[cfg.sub_func_cache_size];
+    p_gen->p_chunk_buf        = (char*)p_gen->p_ctx + ctx_size;
     if (0 == ctx_size)
     {
         p_gen->p_ctx = NULL;
     }
 
-    p_gen->p_indent_filling = p_gen->p_chunk_buf + cfg.max_chunk_size;
+    // The separators of the items at any nesting level are the prefixes of ",\n<indentation for max_nesting_level>".
+    p_gen->p_separators    = p_gen->p_chunk_buf + cfg.max_chunk_size;
+    p_gen->p_separators[0] = ',';
     if (cfg.flag_formatted_json)
     {
-        const size_t indent = (size_t)cfg.indentation * cfg.max_nesting_level;
-        memset(p_gen->p_indent_filling, cfg.indentation_mark, indent);
-        p_gen->p_indent_filling[indent] = '\0';
+        const size_t indent    = (size_t)cfg.indentation * cfg.max_nesting_level;
+        p_gen->p_separators[1] = '\n';
+        memset(&p_gen->p_separators[2], cfg.indentation_mark, indent);
+        p_gen->p_spill_buf = &p_gen->p_separators[indent + 2];
+        p_gen->eol_len     = 1;
+        p_gen->indent_step = cfg.indentation;
     }
     else
     {
-        p_gen->p_indent_filling[0] = '\0';
+        p_gen->p_spill_buf = &p_gen->p_separators[1];
+        p_gen->eol_len     = 0;
+        p_gen->indent_step = 0;
     }
+    p_gen->spill_buf_size = (size_t)cfg.spill_buf_size;
 
-    p_gen->p_eol          = cfg.flag_formatted_json ? "\n" : "";
-    p_gen->p_delimiter[0] = cfg.flag_formatted_json ? cfg.indentation_mark : '\0';
-    p_gen->p_delimiter[1] = '\0';
+    p_gen->key_suffix[0]  = '"';
+    p_gen->key_suffix[1]  = ':';
+    p_gen->key_suffix[2]  = cfg.indentation_mark;
+    p_gen->key_suffix_len = cfg.flag_formatted_json ? 3 : 2;
+    p_gen->decimal_point  = jsg_get_decimal_point(&cfg);
 
     json_stream_gen_reset(p_gen);
 
@@ -197,6 +323,81 @@ json_stream_gen_inc_stage_internal(json_stream_gen_t* const p_gen)
     p_gen->json_stream_gen_stage += 1;
 }
 
+int32_t
+json_stream_gen_resume_internal(json_stream_gen_t* const p_gen)
+{
+    p_gen->json_stream_gen_step = p_gen->resume_step;
+    p_gen->sub_func_record_idx  = 0;
+    p_gen->sub_func_depth       = 0;
+    return p_gen->resume_point;
+}
+
+void
+json_stream_gen_set_resume_point_internal(json_stream_gen_t* const p_gen, const int32_t resume_point)
+{
+    p_gen->resume_point = resume_point;
+    p_gen->resume_step  = p_gen->json_stream_gen_step;
+}
+
+int32_t
+json_stream_gen_begin_sub_func_internal(json_stream_gen_t* const p_gen)
+{
+    const int32_t cur_step = p_gen->json_stream_gen_step;
+    while ((p_gen->sub_func_record_idx < p_gen->num_sub_func_records)
+           && (p_gen->p_sub_func_records[p_gen->sub_func_record_idx].start_step < cur_step))
+    {
+        p_gen->sub_func_record_idx += 1;
+    }
+    // The record of a nested sub-generator which starts at the same step does not cover the current one.
+    if ((p_gen->sub_func_record_idx < p_gen->num_sub_func_records)
+        && (p_gen->p_sub_func_records[p_gen->sub_func_record_idx].start_step == cur_step)
+        && (p_gen->p_sub_func_records[p_gen->sub_func_record_idx].depth == p_gen->sub_func_depth))
+    {
+        p_gen->json_stream_gen_step += p_gen->p_sub_func_records[p_gen->sub_func_record_idx].num_steps;
+        p_gen->sub_func_record_idx += 1;
+        return -1;
+    }
+    p_gen->sub_func_depth += 1;
+    return cur_step;
+}
+
+void
+json_stream_gen_end_sub_func_internal(json_stream_gen_t* const p_gen, const int32_t start_step)
+{
+    const int32_t cur_step = p_gen->json_stream_gen_step;
+    p_gen->sub_func_depth -= 1;
+    if ((cur_step == start_step) || (p_gen->json_stream_gen_stage < cur_step))
+    {
+        return;
+    }
+    // The records of the nested sub-generators are covered by the record of the completed sub-generator.
+    while ((0 != p_gen->num_sub_func_records)
+           && (p_gen->p_sub_func_records[p_gen->num_sub_func_records - 1].start_step >= start_step))
+    {
+        p_gen->num_sub_func_records -= 1;
+    }
+    if (p_gen->num_sub_func_records < p_gen->cfg.sub_func_cache_size)
+    {
+        jsg_sub_func_record_t* const p_record = &p_gen->p_sub_func_records[p_gen->num_sub_func_records];
+        p_record->start_step                  = start_step;
+        p_record->num_steps                   = cur_step - start_step;
+        p_record->depth                       = p_gen->sub_func_depth;
+        p_gen->num_sub_func_records += 1;
+    }
+    p_gen->sub_func_record_idx = p_gen->num_sub_func_records;
+}
+
+const char*
+json_stream_gen_set_literal_key_internal(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_key,
+    const size_t             key_len)
+{
+    p_gen->p_literal_key   = p_key;
+    p_gen->literal_key_len = key_len;
+    return p_key;
+}
+
 void
 json_stream_gen_delete(json_stream_gen_t** p_p_gen)
 {
@@ -205,36 +406,141 @@ json_stream_gen_delete(json_stream_gen_t** p_p_gen)
 }
 
 static bool
-jsg_vprintf(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char* const p_fmt, va_list p_args)
+jsg_spill_append(json_stream_gen_t* const p_gen, const char* const p_data, const size_t len)
 {
-    p_gen->flag_new_data_added    = true;
-    char* const     p_buf         = &p_gen->p_chunk_buf[p_gen->chunk_buf_idx];
-    const size_t    remaining_len = p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx;
-    const jsg_int_t len           = vsnprintf(p_buf, remaining_len, p_fmt, p_args);
-    if (len >= (jsg_int_t)remaining_len)
+    if (len >= (p_gen->spill_buf_size - p_gen->spill_len))
     {
-        p_gen->chunk_buf_idx                     = saved_chunk_buf_idx;
-        p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+        p_gen->spill_state = JSG_SPILL_STATE_NONE;
+        p_gen->spill_len   = 0;
         return false;
     }
-    p_gen->chunk_buf_idx += len;
+    memcpy(&p_gen->p_spill_buf[p_gen->spill_len], p_data, len);
+    p_gen->spill_len += len;
     return true;
 }
 
-__attribute__((format(printf, 3, 4))) static bool
-jsg_printf(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char* const p_fmt, ...)
+/**
+ * @brief Moves the beginning of the item which does not fit into the chunk to the spill buffer.
+ * @details The rest of the item is added to the spill buffer after that, so it's not formatted again
+ * on the next chunk.
+ * @return Returns false if the item can't be moved to the next chunk.
+ */
+static bool
+jsg_spill_start(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx)
 {
-    va_list args;
-    va_start(args, p_fmt);
-    const bool res = jsg_vprintf(p_gen, saved_chunk_buf_idx, p_fmt, args);
-    va_end(args);
-    return res;
+    // If the item does not fit into the empty chunk, then it can't be moved to the next chunk.
+    // The parts of a split value are committed to the chunk one by one, so they must not be spilled.
+    if ((0 == p_gen->spill_buf_size) || p_gen->is_value_split || (0 == saved_chunk_buf_idx))
+    {
+        return false;
+    }
+    const size_t item_len = p_gen->chunk_buf_idx - saved_chunk_buf_idx;
+    if (item_len >= p_gen->spill_buf_size)
+    {
+        return false;
+    }
+    memcpy(p_gen->p_spill_buf, &p_gen->p_chunk_buf[saved_chunk_buf_idx], item_len);
+    p_gen->spill_len                         = item_len;
+    p_gen->spill_state                       = JSG_SPILL_STATE_ACTIVE;
+    p_gen->chunk_buf_idx                     = saved_chunk_buf_idx;
+    p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+    return true;
+}
+
+/**
+ * @brief Appends the bytes to the chunk without formatting them.
+ * @details If the bytes don't fit into the chunk, then the whole item is rolled back to saved_chunk_buf_idx
+ * (or moved to the spill buffer).
+ */
+static bool
+jsg_append(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char* const p_data, const size_t len)
+{
+    p_gen->flag_new_data_added = true;
+    if (p_gen->is_counting_only)
+    {
+        // Only the length of the output is calculated, the bytes are not written to the chunk buffer.
+        if ((p_gen->chunk_buf_idx + len) <= p_gen->seek_offset)
+        {
+            p_gen->chunk_buf_idx += len;
+            return true;
+        }
+        p_gen->chunk_buf_idx = saved_chunk_buf_idx;
+        return false;
+    }
+    if (JSG_SPILL_STATE_ACTIVE == p_gen->spill_state)
+    {
+        if (jsg_spill_append(p_gen, p_data, len))
+        {
+            return true;
+        }
+    }
+    else if (JSG_SPILL_STATE_NONE == p_gen->spill_state)
+    {
+        if ((p_gen->chunk_buf_idx + len) < (size_t)p_gen->cfg.max_chunk_size)
+        {
+            memcpy(&p_gen->p_chunk_buf[p_gen->chunk_buf_idx], p_data, len);
+            p_gen->chunk_buf_idx += len;
+            p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+            return true;
+        }
+        // Keep the item that does not fit into the chunk in the spill buffer to avoid formatting it again.
+        if (jsg_spill_start(p_gen, saved_chunk_buf_idx) && jsg_spill_append(p_gen, p_data, len))
+        {
+            return true;
+        }
+    }
+    else
+    {
+        // The spill buffer is waiting to be flushed, no more items can be added to the current chunk.
+    }
+    p_gen->chunk_buf_idx                     = saved_chunk_buf_idx;
+    p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+    return false;
+}
+
+static bool
+jsg_append_str(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char* const p_str)
+{
+    return jsg_append(p_gen, saved_chunk_buf_idx, p_str, strlen(p_str));
+}
+
+static bool
+jsg_append_char(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char ch)
+{
+    return jsg_append(p_gen, saved_chunk_buf_idx, &ch, 1);
+}
+
+/**
+ * @brief Marks the beginning of a new item.
+ * @details If the previous item has been rendered into the spill buffer, then it's complete now,
+ * and no more items can be added to the current chunk until the spill buffer is flushed to the next one.
+ * @return Returns the index in the chunk buffer to roll back to if the item does not fit into the chunk.
+ */
+static size_t
+jsg_begin_item(json_stream_gen_t* const p_gen)
+{
+    if (JSG_SPILL_STATE_ACTIVE == p_gen->spill_state)
+    {
+        p_gen->spill_state = JSG_SPILL_STATE_PENDING;
+    }
+    return p_gen->chunk_buf_idx;
+}
+
+/**
+ * @brief Checks if no more items can be added to the current chunk because the spill buffer is waiting to be flushed.
+ * @details This allows to skip the formatting of the item which can't be added anyway.
+ */
+static bool
+jsg_is_chunk_closed(json_stream_gen_t* const p_gen)
+{
+    (void)jsg_begin_item(p_gen);
+    return JSG_SPILL_STATE_PENDING == p_gen->spill_state;
 }
 
 static void
 jsg_step_json_opening_bracket(json_stream_gen_t* const p_gen)
 {
-    (void)jsg_printf(p_gen, p_gen->chunk_buf_idx, "{");
+    (void)jsg_append_char(p_gen, p_gen->chunk_buf_idx, '{');
     p_gen->json_gen_state = JSON_STREAM_GEN_STATE_GENERATING_ITEMS;
     p_gen->cur_nesting_level += 1;
 }
@@ -267,7 +573,9 @@ jsg_step_json_closing_bracket(json_stream_gen_t* const p_gen)
         p_gen->json_gen_state = JSON_STREAM_GEN_STATE_ERROR;
         return false;
     }
-    if (!jsg_printf(p_gen, p_gen->chunk_buf_idx, "%s}", p_gen->p_eol))
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if ((!jsg_append(p_gen, saved_chunk_buf_idx, &p_gen->p_separators[1], p_gen->eol_len))
+        || (!jsg_append_char(p_gen, saved_chunk_buf_idx, '}')))
     {
         return false;
     }
@@ -304,11 +612,38 @@ jsg_get_next_chunk_step(json_stream_gen_t* const p_gen)
     return true;
 }
 
-const char*
-json_stream_gen_get_next_chunk(json_stream_gen_t* const p_gen)
+/**
+ * @brief Moves the beginning of the item from the spill buffer to the end of the chunk to fill it up completely.
+ */
+static void
+jsg_fill_chunk_from_spill_buf(json_stream_gen_t* const p_gen)
+{
+    const size_t remaining_len = (size_t)p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx - 1;
+    const size_t len_to_copy   = (p_gen->spill_len < remaining_len) ? p_gen->spill_len : remaining_len;
+    memcpy(&p_gen->p_chunk_buf[p_gen->chunk_buf_idx], p_gen->p_spill_buf, len_to_copy);
+    p_gen->chunk_buf_idx += len_to_copy;
+    p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+    p_gen->spill_len -= len_to_copy;
+    memmove(p_gen->p_spill_buf, &p_gen->p_spill_buf[len_to_copy], p_gen->spill_len);
+    if (0 == p_gen->spill_len)
+    {
+        p_gen->spill_state = JSG_SPILL_STATE_NONE;
+    }
+}
+
+static const char*
+jsg_generate_chunk(json_stream_gen_t* const p_gen)
 {
     p_gen->chunk_buf_idx  = 0;
     p_gen->p_chunk_buf[0] = '\0';
+    if (JSG_SPILL_STATE_NONE != p_gen->spill_state)
+    {
+        memcpy(p_gen->p_chunk_buf, p_gen->p_spill_buf, p_gen->spill_len);
+        p_gen->chunk_buf_idx                     = p_gen->spill_len;
+        p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+        p_gen->spill_len                         = 0;
+        p_gen->spill_state                       = JSG_SPILL_STATE_NONE;
+    }
     while (jsg_get_next_chunk_step(p_gen))
     {
         // Continuously fetch and add the next portion of data to the chunk as long as such data is available.
@@ -319,9 +654,62 @@ json_stream_gen_get_next_chunk(json_stream_gen_t* const p_gen)
     {
         return NULL;
     }
+    if (p_gen->cfg.flag_pack_chunks && (JSG_SPILL_STATE_NONE != p_gen->spill_state))
+    {
+        jsg_fill_chunk_from_spill_buf(p_gen);
+    }
     return p_gen->p_chunk_buf;
 }
 
+const char*
+json_stream_gen_get_next_chunk(json_stream_gen_t* const p_gen)
+{
+    const char* p_chunk = jsg_generate_chunk(p_gen);
+    // After seeking, drop the beginning of the item which crosses the seek offset.
+    while ((NULL != p_chunk) && (0 != p_gen->skip_len) && (0 != p_gen->chunk_buf_idx))
+    {
+        if (p_gen->chunk_buf_idx > p_gen->skip_len)
+        {
+            p_gen->chunk_buf_idx -= p_gen->skip_len;
+            memmove(p_gen->p_chunk_buf, &p_gen->p_chunk_buf[p_gen->skip_len], p_gen->chunk_buf_idx + 1);
+            p_gen->skip_len = 0;
+            break;
+        }
+        p_gen->skip_len -= p_gen->chunk_buf_idx;
+        p_chunk = jsg_generate_chunk(p_gen);
+    }
+    return p_chunk;
+}
+
+bool
+json_stream_gen_seek(json_stream_gen_t* const p_gen, const json_stream_gen_size_t byte_offset)
+{
+    json_stream_gen_reset(p_gen);
+    if (byte_offset <= 0)
+    {
+        return 0 == byte_offset;
+    }
+    // Run the generator as if the whole JSON up to the seek offset was one chunk, but without writing the bytes,
+    // and stop at the first item that does not fit before the seek offset.
+    p_gen->is_counting_only = true;
+    p_gen->seek_offset      = (size_t)byte_offset;
+    while (jsg_get_next_chunk_step(p_gen))
+    {
+        // Continuously count the length of the items as long as they fit before the seek offset.
+    }
+    p_gen->is_counting_only = false;
+    if ((JSON_STREAM_GEN_STATE_ERROR_INSUFFICIENT_BUFFER == p_gen->json_gen_state)
+        || (JSON_STREAM_GEN_STATE_ERROR == p_gen->json_gen_state)
+        || ((JSON_STREAM_GEN_STATE_FINISHED == p_gen->json_gen_state) && (p_gen->chunk_buf_idx != p_gen->seek_offset)))
+    {
+        json_stream_gen_reset(p_gen);
+        return false;
+    }
+    p_gen->skip_len      = p_gen->seek_offset - p_gen->chunk_buf_idx;
+    p_gen->chunk_buf_idx = 0;
+    return true;
+}
+
 json_stream_gen_size_t
 json_stream_gen_calc_size(json_stream_gen_t* const p_gen)
 {
@@ -352,41 +740,181 @@ json_stream_gen_calc_size(json_stream_gen_t* const p_gen)
     return json_len;
 }
 
+size_t
+json_stream_gen_get_saved_state_size(const json_stream_gen_t* const p_gen)
+{
+    return sizeof(jsg_saved_state_t) + p_gen->spill_len;
+}
+
+bool
+json_stream_gen_save_state(const json_stream_gen_t* const p_gen, void* const p_buf, const size_t buf_size)
+{
+    if (buf_size < json_stream_gen_get_saved_state_size(p_gen))
+    {
+        return false;
+    }
+    jsg_saved_state_t state;
+    // Clear the padding bytes, so that the uninitialized memory does not get into the saved state.
+    memset(&state, 0, sizeof(state));
+    state.magic                 = JSG_SAVED_STATE_MAGIC;
+    state.json_stream_gen_step  = p_gen->json_stream_gen_step;
+    state.json_stream_gen_stage = p_gen->json_stream_gen_stage;
+    state.resume_point          = p_gen->resume_point;
+    state.resume_step           = p_gen->resume_step;
+    state.cur_nesting_level     = p_gen->cur_nesting_level;
+    state.json_gen_state        = p_gen->json_gen_state;
+    state.spill_state           = p_gen->spill_state;
+    state.is_first_item         = p_gen->is_first_item ? 1U : 0U;
+    state.is_array_started      = p_gen->is_array_started ? 1U : 0U;
+    state.is_value_split        = p_gen->is_value_split ? 1U : 0U;
+    state.array_elem_idx        = p_gen->array_elem_idx;
+    state.value_offset          = p_gen->value_offset;
+    state.skip_len              = p_gen->skip_len;
+    state.spill_len             = p_gen->spill_len;
+    memcpy(p_buf, &state, sizeof(state));
+    memcpy((uint8_t*)p_buf + sizeof(state), p_gen->p_spill_buf, p_gen->spill_len);
+    return true;
+}
+
+/**
+ * @brief Checks that the fields of the saved state, which are not limited by the generator configuration, are valid.
+ * @details An out-of-range state would make the generator loop forever or access the spill buffer incorrectly.
+ */
+static bool
+jsg_is_saved_state_consistent(const jsg_saved_state_t* const p_state, const bool flag_pack_chunks)
+{
+    if (((uint32_t)p_state->json_gen_state > (uint32_t)JSON_STREAM_GEN_STATE_ERROR)
+        || ((uint32_t)p_state->spill_state > (uint32_t)JSG_SPILL_STATE_PENDING))
+    {
+        return false;
+    }
+    if ((p_state->is_first_item > 1U) || (p_state->is_array_started > 1U) || (p_state->is_value_split > 1U))
+    {
+        return false;
+    }
+    if (JSG_SPILL_STATE_NONE == p_state->spill_state)
+    {
+        return 0 == p_state->spill_len;
+    }
+    // The spill buffer is never empty while it's in use. A split value can use it only if the chunks are packed:
+    // the beginning of the item and the part which does not fit into the chunk are carried over to the next one.
+    return (0 != p_state->spill_len) && ((0 == p_state->is_value_split) || flag_pack_chunks);
+}
+
+bool
+json_stream_gen_restore_state(json_stream_gen_t* const p_gen, const void* const p_buf, const size_t buf_size)
+{
+    jsg_saved_state_t state = { 0 };
+    if (buf_size < sizeof(state))
+    {
+        return false;
+    }
+    memcpy(&state, p_buf, sizeof(state));
+    if ((JSG_SAVED_STATE_MAGIC != state.magic) || (buf_size < (sizeof(state) + state.spill_len))
+        || (state.spill_len > p_gen->spill_buf_size) || (state.cur_nesting_level > p_gen->cfg.max_nesting_level))
+    {
+        return false;
+    }
+    if (!jsg_is_saved_state_consistent(&state, p_gen->cfg.flag_pack_chunks))
+    {
+        return false;
+    }
+    json_stream_gen_reset(p_gen);
+    p_gen->json_stream_gen_step  = state.json_stream_gen_step;
+    p_gen->json_stream_gen_stage = state.json_stream_gen_stage;
+    p_gen->resume_point          = state.resume_point;
+    p_gen->resume_step           = state.resume_step;
+    p_gen->cur_nesting_level     = state.cur_nesting_level;
+    p_gen->json_gen_state        = state.json_gen_state;
+    p_gen->spill_state           = state.spill_state;
+    p_gen->is_first_item         = (0 != state.is_first_item);
+    p_gen->is_array_started      = (0 != state.is_array_started);
+    p_gen->is_value_split        = (0 != state.is_value_split);
+    p_gen->array_elem_idx        = state.array_elem_idx;
+    p_gen->value_offset          = state.value_offset;
+    p_gen->skip_len              = state.skip_len;
+    p_gen->spill_len             = state.spill_len;
+    memcpy(p_gen->p_spill_buf, (const uint8_t*)p_buf + sizeof(state), state.spill_len);
+    // The sub-func cache is not saved, the completed sub-generators are recorded again while they are being replayed.
+    return true;
+}
+
+void
+json_stream_gen_refresh_locale(json_stream_gen_t* const p_gen)
+{
+    p_gen->decimal_point = jsg_get_decimal_point(&p_gen->cfg);
+}
+
 void
 json_stream_gen_reset(json_stream_gen_t* const p_gen)
 {
     p_gen->json_stream_gen_step  = 0;
     p_gen->json_stream_gen_stage = 0;
+    p_gen->resume_point          = 0;
+    p_gen->resume_step           = 0;
     p_gen->json_gen_state        = JSON_STREAM_GEN_STATE_JSON_OPENING_BRACKET;
     p_gen->cur_nesting_level     = 0;
     p_gen->is_first_item         = true;
+    p_gen->is_array_started      = false;
+    p_gen->array_elem_idx        = 0;
+    p_gen->is_value_split        = false;
+    p_gen->value_offset          = 0;
+    p_gen->num_sub_func_records  = 0;
+    p_gen->sub_func_record_idx   = 0;
+    p_gen->sub_func_depth        = 0;
+    p_gen->spill_len             = 0;
+    p_gen->spill_state           = JSG_SPILL_STATE_NONE;
+    p_gen->is_counting_only      = false;
+    p_gen->seek_offset           = 0;
+    p_gen->skip_len              = 0;
     p_gen->chunk_buf_idx         = 0;
+    p_gen->p_literal_key         = NULL;
+    p_gen->literal_key_len       = 0;
+}
+
+static bool
+jsg_append_escaped(
+    json_stream_gen_t* const p_gen,
+    const size_t             saved_chunk_buf_idx,
+    const char* const        p_str,
+    const size_t             len);
+
+/**
+ * @brief Appends the separator of the item: the comma (if needed), the end of line and the indentation
+ * for the given nesting level (there is neither end of line nor indentation in compact JSON).
+ * @details The separator is a prefix of the pre-built fragment, so it's copied with a single memcpy.
+ */
+static bool
+jsg_append_separator(
+    json_stream_gen_t* const p_gen,
+    const size_t             saved_chunk_buf_idx,
+    const uint32_t           nesting_level,
+    const bool               flag_comma)
+{
+    const char* const p_separator = flag_comma ? p_gen->p_separators : &p_gen->p_separators[1];
+    const size_t      indent      = (size_t)nesting_level * p_gen->indent_step;
+    return jsg_append(p_gen, saved_chunk_buf_idx, p_separator, (flag_comma ? 1U : 0U) + p_gen->eol_len + indent);
 }
 
+/**
+ * @brief Prints the separator, the indentation and the key of the item.
+ * @details The key is escaped like the string values (usually it's copied as a whole),
+ * and it's followed by the suffix '":' and the delimiter, which is prepared in json_stream_gen_create.
+ */
 static bool
 jsg_print_prefix(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char* const p_name)
 {
-    const jsg_int_t   indent = (jsg_int_t)p_gen->cur_nesting_level * (jsg_int_t)p_gen->cfg.indentation;
-    const char* const p_sep  = p_gen->is_first_item ? "" : ",";
-    if (NULL != p_name)
+    if (!jsg_append_separator(p_gen, saved_chunk_buf_idx, p_gen->cur_nesting_level, !p_gen->is_first_item))
     {
-        if (!jsg_printf(
-                p_gen,
-                saved_chunk_buf_idx,
-                "%s%s%.*s\"%s\":%s",
-                p_sep,
-                p_gen->p_eol,
-                indent,
-                p_gen->p_indent_filling,
-                p_name,
-                p_gen->p_delimiter))
-        {
-            return false;
-        }
+        return false;
     }
-    else
+    if (NULL != p_name)
     {
-        if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s%s%.*s", p_sep, p_gen->p_eol, indent, p_gen->p_indent_filling))
+        // The length of the literal key is known at compile time, so it's scanned only once to check for escaping.
+        const size_t name_len = (p_name == p_gen->p_literal_key) ? p_gen->literal_key_len : strlen(p_name);
+        if ((!jsg_append_char(p_gen, saved_chunk_buf_idx, '"'))
+            || (!jsg_append_escaped(p_gen, saved_chunk_buf_idx, p_name, name_len))
+            || (!jsg_append(p_gen, saved_chunk_buf_idx, p_gen->key_suffix, p_gen->key_suffix_len)))
         {
             return false;
         }
@@ -403,12 +931,12 @@ jsg_start_obj_or_arr(json_stream_gen_t* const p_gen, const char* const p_name, c
         return false;
     }
 
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%c", symbol))
+    if (!jsg_append_char(p_gen, saved_chunk_buf_idx, symbol))
     {
         return false;
     }
@@ -438,17 +966,18 @@ jsg_end_obj_or_array(json_stream_gen_t* const p_gen, const char symbol)
         p_gen->json_gen_state = JSON_STREAM_GEN_STATE_ERROR;
         return false;
     }
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
     if (p_gen->is_first_item)
     {
-        if (!jsg_printf(p_gen, p_gen->chunk_buf_idx, "%c", symbol))
+        if (!jsg_append_char(p_gen, saved_chunk_buf_idx, symbol))
         {
             return false;
         }
     }
     else
     {
-        const jsg_int_t indent = ((jsg_int_t)p_gen->cur_nesting_level - 1) * (jsg_int_t)p_gen->cfg.indentation;
-        if (!jsg_printf(p_gen, p_gen->chunk_buf_idx, "%s%.*s%c", p_gen->p_eol, indent, p_gen->p_indent_filling, symbol))
+        if ((!jsg_append_separator(p_gen, saved_chunk_buf_idx, p_gen->cur_nesting_level - 1, false))
+            || (!jsg_append_char(p_gen, saved_chunk_buf_idx, symbol)))
         {
             return false;
         }
@@ -470,329 +999,565 @@ json_stream_gen_end_array(json_stream_gen_t* const p_gen)
     return jsg_end_obj_or_array(p_gen, ']');
 }
 
-#define JSG_ESCAPED_CHAR_BUF_SIZE (6U)
+#define JSG_ESCAPE_SEQ_MAX_LEN (6U)
+#define JSG_NUM_CTRL_CHARS     (0x20U)
+
+/**
+ * @brief The escape sequence of a character and its length.
+ */
+typedef struct jsg_escape_seq_t
+{
+    char    seq[JSG_ESCAPE_SEQ_MAX_LEN + 1];
+    uint8_t len;
+} jsg_escape_seq_t;
+
+/**
+ * @brief The escape sequences of the control characters, the short form is used where JSON defines it.
+ */
+static const jsg_escape_seq_t g_jsg_ctrl_char_escape_seqs[JSG_NUM_CTRL_CHARS] = {
+    { "\\u0000", 6 },
+    { "\\u0001", 6 },
+    { "\\u0002", 6 },
+    { "\\u0003", 6 },
+    { "\\u0004", 6 },
+    { "\\u0005", 6 },
+    { "\\u0006", 6 },
+    { "\\u0007", 6 },
+    { "\\b", 2 },
+    { "\\t", 2 },
+    { "\\n", 2 },
+    { "\\u000b", 6 },
+    { "\\f", 2 },
+    { "\\r", 2 },
+    { "\\u000e", 6 },
+    { "\\u000f", 6 },
+    { "\\u0010", 6 },
+    { "\\u0011", 6 },
+    { "\\u0012", 6 },
+    { "\\u0013", 6 },
+    { "\\u0014", 6 },
+    { "\\u0015", 6 },
+    { "\\u0016", 6 },
+    { "\\u0017", 6 },
+    { "\\u0018", 6 },
+    { "\\u0019", 6 },
+    { "\\u001a", 6 },
+    { "\\u001b", 6 },
+    { "\\u001c", 6 },
+    { "\\u001d", 6 },
+    { "\\u001e", 6 },
+    { "\\u001f", 6 },
+};
+
+static const jsg_escape_seq_t g_jsg_quote_escape_seq     = { "\\\"", 2 };
+static const jsg_escape_seq_t g_jsg_backslash_escape_seq = { "\\\\", 2 };
 
-typedef struct jsg_escaped_char_t
+static inline bool
+jsg_is_char_to_escape(const char input_char)
 {
-    char buf[JSG_ESCAPED_CHAR_BUF_SIZE];
-} jsg_escaped_char_t;
+    return ((uint8_t)input_char < (uint8_t)' ') || ('"' == input_char) || ('\\' == input_char);
+}
 
-static bool
-jsg_check_char_escaping(const char input_char, jsg_escaped_char_t* const p_output_char)
+/**
+ * @brief Returns the escape sequence of the character, which must be one of the characters that need escaping.
+ */
+static const jsg_escape_seq_t*
+jsg_get_escape_seq(const char input_char)
 {
-    if (((uint8_t)input_char >= (uint8_t)' ') && (input_char != '\"') && (input_char != '\\'))
-    {
-        if (NULL != p_output_char)
-        {
-            p_output_char->buf[0] = input_char;
-            p_output_char->buf[1] = '\0';
-        }
-        return false;
-    }
-    if (NULL == p_output_char)
+    if ('"' == input_char)
     {
-        return true;
+        return &g_jsg_quote_escape_seq;
     }
-
-    p_output_char->buf[1] = '\0';
-    switch (input_char)
+    if ('\\' == input_char)
     {
-        case '\"':
-            p_output_char->buf[0] = '\"';
-            break;
-        case '\\':
-            p_output_char->buf[0] = '\\';
-            break;
-        case '\b':
-            p_output_char->buf[0] = 'b';
-            break;
-        case '\f':
-            p_output_char->buf[0] = 'f';
-            break;
-        case '\n':
-            p_output_char->buf[0] = 'n';
-            break;
-        case '\r':
-            p_output_char->buf[0] = 'r';
-            break;
-        case '\t':
-            p_output_char->buf[0] = 't';
-            break;
-        default:
-            /* escape and print as unicode codepoint */
-            (void)snprintf(p_output_char->buf, sizeof(p_output_char->buf), "u%04x", (uint8_t)input_char);
-            break;
+        return &g_jsg_backslash_escape_seq;
     }
-    return true;
+    return &g_jsg_ctrl_char_escape_seqs[(uint8_t)input_char];
 }
 
-static bool
-jsg_check_if_str_need_escaping(const char* const p_val)
+#define JSG_SWAR_ONES      (0x0101010101010101ULL)
+#define JSG_SWAR_HIGH_BITS (0x8080808080808080ULL)
+
+/**
+ * @brief Checks whether any byte in the word is less than the given value (which must not be greater than 128).
+ */
+static inline bool
+jsg_swar_has_less(const uint64_t word, const uint8_t val)
 {
-    for (const char* p_char = p_val; '\0' != *p_char; ++p_char)
-    {
-        if (jsg_check_char_escaping(*p_char, NULL))
-        {
-            return true;
-        }
-    }
-    return false;
+    return 0 != ((word - (JSG_SWAR_ONES * val)) & ~word & JSG_SWAR_HIGH_BITS);
 }
 
-bool
-json_stream_gen_add_string(json_stream_gen_t* const p_gen, const char* const p_name, const char* const p_val)
+static inline bool
+jsg_swar_has_byte(const uint64_t word, const uint8_t val)
 {
-    if (NULL == p_val)
-    {
-        return json_stream_gen_add_null(p_gen, p_name);
-    }
-    if (!jsg_check_if_str_need_escaping(p_val))
-    {
-        return json_stream_gen_add_raw_string(p_gen, p_name, p_val);
-    }
+    return jsg_swar_has_less(word ^ (JSG_SWAR_ONES * val), 1U);
+}
 
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
+/**
+ * @brief Finds the first character of the string which needs escaping: a control character, '"' or '\\'.
+ * @details The string is checked by 32 (AVX2) or 16 (SSE2, NEON) bytes at a time,
+ * or by 8 bytes at a time (SWAR) on other platforms, the tail of the string is checked byte by byte.
+ * Define JSON_STREAM_GEN_DISABLE_SIMD to use only the portable SWAR implementation.
+ * @param p_str is a pointer to the string.
+ * @param len is the length of the string.
+ * @return Returns the offset of the first character which needs escaping or len if there are no such characters.
+ */
+static size_t
+jsg_find_char_to_escape(const char* const p_str, const size_t len)
+{
+    size_t idx = 0;
+#if defined(JSG_SIMD_AVX2)
+    const __m256i quote_x32     = _mm256_set1_epi8('\"');
+    const __m256i backslash_x32 = _mm256_set1_epi8('\\');
+    const __m256i max_ctrl_x32  = _mm256_set1_epi8(0x1F);
+    while ((len - idx) >= sizeof(__m256i))
+    {
+        const __m256i  chars     = _mm256_loadu_si256((const __m256i*)(const void*)&p_str[idx]);
+        const __m256i  is_ctrl   = _mm256_cmpeq_epi8(_mm256_min_epu8(chars, max_ctrl_x32), chars);
+        const __m256i  is_quote  = _mm256_cmpeq_epi8(chars, quote_x32);
+        const __m256i  is_bslash = _mm256_cmpeq_epi8(chars, backslash_x32);
+        const __m256i  flags     = _mm256_or_si256(is_ctrl, _mm256_or_si256(is_quote, is_bslash));
+        const uint32_t mask      = (uint32_t)_mm256_movemask_epi8(flags);
+        if (0 != mask)
+        {
+            return idx + (size_t)__builtin_ctz(mask);
+        }
+        idx += sizeof(__m256i);
+    }
+#elif defined(JSG_SIMD_SSE2)
+    const __m128i quote_x16     = _mm_set1_epi8('\"');
+    const __m128i backslash_x16 = _mm_set1_epi8('\\');
+    const __m128i max_ctrl_x16  = _mm_set1_epi8(0x1F);
+    while ((len - idx) >= sizeof(__m128i))
+    {
+        const __m128i  chars     = _mm_loadu_si128((const __m128i*)(const void*)&p_str[idx]);
+        const __m128i  is_ctrl   = _mm_cmpeq_epi8(_mm_min_epu8(chars, max_ctrl_x16), chars);
+        const __m128i  is_quote  = _mm_cmpeq_epi8(chars, quote_x16);
+        const __m128i  is_bslash = _mm_cmpeq_epi8(chars, backslash_x16);
+        const __m128i  flags     = _mm_or_si128(is_ctrl, _mm_or_si128(is_quote, is_bslash));
+        const uint32_t mask      = (uint32_t)_mm_movemask_epi8(flags);
+        if (0 != mask)
+        {
+            return idx + (size_t)__builtin_ctz(mask);
+        }
+        idx += sizeof(__m128i);
+    }
+#elif defined(JSG_SIMD_NEON)
+    const uint8x16_t quote_x16     = vdupq_n_u8((uint8_t)'\"');
+    const uint8x16_t backslash_x16 = vdupq_n_u8((uint8_t)'\\');
+    const uint8x16_t space_x16     = vdupq_n_u8((uint8_t)' ');
+    while ((len - idx) >= sizeof(uint8x16_t))
+    {
+        const uint8x16_t chars = vld1q_u8((const uint8_t*)&p_str[idx]);
+        const uint8x16_t flags = vorrq_u8(
+            vcltq_u8(chars, space_x16),
+            vorrq_u8(vceqq_u8(chars, quote_x16), vceqq_u8(chars, backslash_x16)));
+        if (0 != vmaxvq_u8(flags))
+        {
+            break; // The exact position is found by the code below.
+        }
+        idx += sizeof(uint8x16_t);
+    }
+#endif
+    while ((len - idx) >= sizeof(uint64_t))
     {
-        return false;
+        uint64_t word = 0;
+        memcpy(&word, &p_str[idx], sizeof(word));
+        if (jsg_swar_has_less(word, (uint8_t)' ') || jsg_swar_has_byte(word, (uint8_t)'\"')
+            || jsg_swar_has_byte(word, (uint8_t)'\\'))
+        {
+            break; // The exact position is found by the code below.
+        }
+        idx += sizeof(uint64_t);
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "\""))
+    while ((idx < len) && (!jsg_is_char_to_escape(p_str[idx])))
     {
-        return false;
+        idx += 1;
     }
+    return idx;
+}
 
-    for (const char* p_char = p_val; '\0' != *p_char; ++p_char)
+/**
+ * @brief Appends the string with escaping, the runs of characters which do not need escaping are copied as a whole.
+ */
+static bool
+jsg_append_escaped(
+    json_stream_gen_t* const p_gen,
+    const size_t             saved_chunk_buf_idx,
+    const char* const        p_str,
+    const size_t             len)
+{
+    size_t offset = 0;
+    while (offset < len)
     {
-        jsg_escaped_char_t escaped_char = { '\0' };
-        const bool         flag_escape  = jsg_check_char_escaping(*p_char, &escaped_char);
-        if (flag_escape)
+        const size_t run_len = jsg_find_char_to_escape(&p_str[offset], len - offset);
+        if ((0 != run_len) && (!jsg_append(p_gen, saved_chunk_buf_idx, &p_str[offset], run_len)))
         {
-            if (!jsg_printf(p_gen, saved_chunk_buf_idx, "\\%s", escaped_char.buf))
-            {
-                return false;
-            }
+            return false;
         }
-        else
+        offset += run_len;
+        if (offset < len)
         {
-            if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%c", *p_char))
+            const jsg_escape_seq_t* const p_seq = jsg_get_escape_seq(p_str[offset]);
+            if (!jsg_append(p_gen, saved_chunk_buf_idx, p_seq->seq, p_seq->len))
             {
                 return false;
             }
+            offset += 1;
         }
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "\""))
-    {
-        return false;
-    }
-    p_gen->is_first_item = false;
     return true;
 }
 
-bool
-json_stream_gen_add_raw_string(json_stream_gen_t* const p_gen, const char* const p_name, const char* const p_val)
+/**
+ * @brief Starts a string or hex value which does not fit even into the empty chunk.
+ * @details Such a value is split between several chunks: the prefix and the opening quote are printed now,
+ * and the value is continued from the saved offset on the next calls.
+ * If the chunks are packed, then the value is split starting from the current chunk.
+ * @return Returns false if the value should be added to the next chunk as a whole or if it can't be split.
+ */
+static bool
+jsg_start_split_value(json_stream_gen_t* const p_gen, const size_t saved_chunk_buf_idx, const char* const p_name)
 {
-    if (NULL == p_val)
+    if ((!p_gen->cfg.flag_split_long_values) || p_gen->is_counting_only
+        || ((0 != saved_chunk_buf_idx) && (!p_gen->cfg.flag_pack_chunks)))
     {
-        return json_stream_gen_add_null(p_gen, p_name);
+        return false;
     }
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "\"%s\"", p_val))
+    if (!jsg_append_char(p_gen, saved_chunk_buf_idx, '"'))
     {
         return false;
     }
-    p_gen->is_first_item = false;
+    p_gen->is_value_split = true;
+    p_gen->value_offset   = 0;
     return true;
 }
 
-bool
-json_stream_gen_add_int32(json_stream_gen_t* const p_gen, const char* const p_name, const int32_t val)
+/**
+ * @brief Commits the next part of the split value to the chunk.
+ * @details If the chunks are packed and the part does not fit into the rest of the chunk,
+ * then the chunk is filled up to the end, and the rest of the part is carried over to the next chunk.
+ * @return Returns false if the part was not added and the value should be continued in the next chunk.
+ */
+static bool
+jsg_put_split_value_part(json_stream_gen_t* const p_gen, const char* const p_part, const size_t part_len)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
+    p_gen->flag_new_data_added = true;
+    if (JSG_SPILL_STATE_NONE != p_gen->spill_state)
     {
+        // The beginning of the item has been moved to the spill buffer, so the value continues in the next chunk.
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%" PRId32, val))
+    const size_t remaining_len = (size_t)p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx - 1;
+    size_t       len_to_copy   = part_len;
+    if (part_len > remaining_len)
     {
-        return false;
-    }
-    p_gen->is_first_item = false;
+        if ((!p_gen->cfg.flag_pack_chunks) || (0 == remaining_len))
+        {
+            return false;
+        }
+        len_to_copy = remaining_len;
+        memcpy(p_gen->p_spill_buf, &p_part[len_to_copy], part_len - len_to_copy);
+        p_gen->spill_len   = part_len - len_to_copy;
+        p_gen->spill_state = JSG_SPILL_STATE_PENDING;
+    }
+    memcpy(&p_gen->p_chunk_buf[p_gen->chunk_buf_idx], p_part, len_to_copy);
+    p_gen->chunk_buf_idx += len_to_copy;
+    p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
     return true;
 }
 
-bool
-json_stream_gen_add_uint32(json_stream_gen_t* const p_gen, const char* const p_name, const uint32_t val)
+static bool
+jsg_finish_split_value(json_stream_gen_t* const p_gen)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
-    {
-        return false;
-    }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%" PRIu32, val))
+    if (!jsg_put_split_value_part(p_gen, "\"", 1))
     {
         return false;
     }
-    p_gen->is_first_item = false;
+    p_gen->is_value_split = false;
+    p_gen->value_offset   = 0;
+    p_gen->is_first_item  = false;
     return true;
 }
 
-bool
-json_stream_gen_add_int64(json_stream_gen_t* const p_gen, const char* const p_name, const int64_t val)
+/**
+ * @brief Prints the string value with escaping.
+ */
+static bool
+jsg_print_escaped_string(
+    json_stream_gen_t* const p_gen,
+    const size_t             saved_chunk_buf_idx,
+    const char* const        p_name,
+    const char* const        p_val,
+    const size_t             val_len)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%" PRId64, val))
+    if (!jsg_append_char(p_gen, saved_chunk_buf_idx, '"'))
     {
         return false;
     }
-    p_gen->is_first_item = false;
-    return true;
+    if (!jsg_append_escaped(p_gen, saved_chunk_buf_idx, p_val, val_len))
+    {
+        return false;
+    }
+    return jsg_append_char(p_gen, saved_chunk_buf_idx, '"');
 }
 
 bool
-json_stream_gen_add_uint64(json_stream_gen_t* const p_gen, const char* const p_name, const uint64_t val)
+json_stream_gen_add_string(json_stream_gen_t* const p_gen, const char* const p_name, const char* const p_val)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
-    {
-        return false;
-    }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%" PRIu64, val))
+    if (NULL == p_val)
     {
-        return false;
+        return json_stream_gen_add_null(p_gen, p_name);
     }
-    p_gen->is_first_item = false;
-    return true;
+    return json_stream_gen_add_string_n(p_gen, p_name, p_val, strlen(p_val));
 }
 
 bool
-json_stream_gen_add_bool(json_stream_gen_t* const p_gen, const char* const p_name, const bool val)
+json_stream_gen_add_string_n(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const char* const        p_val,
+    const size_t             val_len)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
+    if (NULL == p_val)
     {
-        return false;
+        return json_stream_gen_add_null(p_gen, p_name);
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s", val ? "true" : "false"))
+    if (jsg_find_char_to_escape(p_val, val_len) == val_len)
     {
-        return false;
+        return json_stream_gen_add_raw_string_n(p_gen, p_name, p_val, val_len);
     }
-    p_gen->is_first_item = false;
-    return true;
+
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!p_gen->is_value_split)
+    {
+        if (jsg_print_escaped_string(p_gen, saved_chunk_buf_idx, p_name, p_val, val_len))
+        {
+            p_gen->is_first_item = false;
+            return true;
+        }
+        if (!jsg_start_split_value(p_gen, saved_chunk_buf_idx, p_name))
+        {
+            return false;
+        }
+    }
+    // Every part of the split value is committed to the chunk as soon as it is printed.
+    while (p_gen->value_offset < val_len)
+    {
+        const char* const p_part  = &p_val[p_gen->value_offset];
+        const size_t      run_len = jsg_find_char_to_escape(p_part, val_len - p_gen->value_offset);
+        if (0 == run_len)
+        {
+            const jsg_escape_seq_t* const p_seq = jsg_get_escape_seq(*p_part);
+            if (!jsg_put_split_value_part(p_gen, p_seq->seq, p_seq->len))
+            {
+                return false;
+            }
+            p_gen->value_offset += 1;
+            continue;
+        }
+        const size_t remaining_len = (size_t)p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx - 1;
+        const size_t part_len      = (run_len < remaining_len) ? run_len : remaining_len;
+        if ((0 == part_len) || (!jsg_put_split_value_part(p_gen, p_part, part_len)))
+        {
+            return false;
+        }
+        p_gen->value_offset += part_len;
+    }
+    return jsg_finish_split_value(p_gen);
 }
 
 bool
-json_stream_gen_add_null(json_stream_gen_t* const p_gen, const char* const p_name)
+json_stream_gen_add_raw_string(json_stream_gen_t* const p_gen, const char* const p_name, const char* const p_val)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
-    {
-        return false;
-    }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s", "null"))
+    if (NULL == p_val)
     {
-        return false;
+        return json_stream_gen_add_null(p_gen, p_name);
     }
-    p_gen->is_first_item = false;
-    return true;
+    return json_stream_gen_add_raw_string_n(p_gen, p_name, p_val, strlen(p_val));
 }
 
-static char
-jsg_get_decimal_point(const json_stream_gen_t* const p_gen)
+bool
+json_stream_gen_add_raw_string_n(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const char* const        p_val,
+    const size_t             val_len)
 {
-    const struct lconv* const p_lc = p_gen->cfg.p_localeconv();
-    if (NULL == p_lc)
+    if (NULL == p_val)
     {
-        return '.';
+        return json_stream_gen_add_null(p_gen, p_name);
     }
-    return *p_lc->decimal_point;
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!p_gen->is_value_split)
+    {
+        if (jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name) && jsg_append_char(p_gen, saved_chunk_buf_idx, '"')
+            && jsg_append(p_gen, saved_chunk_buf_idx, p_val, val_len)
+            && jsg_append_char(p_gen, saved_chunk_buf_idx, '"'))
+        {
+            p_gen->is_first_item = false;
+            return true;
+        }
+        if (!jsg_start_split_value(p_gen, saved_chunk_buf_idx, p_name))
+        {
+            return false;
+        }
+    }
+    // Every part of the split value is committed to the chunk as soon as it is printed.
+    while (p_gen->value_offset < val_len)
+    {
+        const size_t remaining_len = (size_t)p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx - 1;
+        const size_t part_len = ((val_len - p_gen->value_offset) < remaining_len) ? (val_len - p_gen->value_offset)
+                                                                                  : remaining_len;
+        if ((0 == part_len) || (!jsg_put_split_value_part(p_gen, &p_val[p_gen->value_offset], part_len)))
+        {
+            return false;
+        }
+        p_gen->value_offset += part_len;
+    }
+    return jsg_finish_split_value(p_gen);
 }
 
-typedef struct jsg_float_str_buf_t
+/**
+ * @brief The decimal representation of the numbers from 0 to 99, two digits per number.
+ */
+static const char g_jsg_digit_pairs[] = "00010203040506070809"
+                                        "10111213141516171819"
+                                        "20212223242526272829"
+                                        "30313233343536373839"
+                                        "40414243444546474849"
+                                        "50515253545556575859"
+                                        "60616263646566676869"
+                                        "70717273747576777879"
+                                        "80818283848586878889"
+                                        "90919293949596979899";
+
+typedef struct jsg_int_str_buf_t
 {
-    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_FLOAT];
-} jsg_float_str_buf_t;
+    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_INT];
+} jsg_int_str_buf_t;
 
-static bool
-jsg_float_to_str(
-    const json_stream_gen_t* const            p_gen,
-    const float_t                             val,
-    const bool                                flag_fixed_point,
-    const json_stream_gen_ieee754_precision_t precision,
-    jsg_float_str_buf_t* const                p_str)
+/**
+ * @brief Prints the decimal digits of the value backwards from p_end, two digits per step.
+ * @return Returns a pointer to the first digit.
+ */
+static char*
+jsg_u32_to_str_backward(uint32_t val, char* p_end)
 {
-    if ((0 != isnanf(val)) || (0 != isinff(val)))
+    while (val >= JSON_STREAM_GEN_CONST_U32_100)
     {
-        return false;
+        const uint32_t idx = (val % JSON_STREAM_GEN_CONST_U32_100) * 2U;
+        val /= JSON_STREAM_GEN_CONST_U32_100;
+        p_end -= 2;
+        memcpy(p_end, &g_jsg_digit_pairs[idx], 2);
     }
-    jsg_int_t len = 0;
-    if (flag_fixed_point)
+    if (val >= JSON_STREAM_GEN_CONST_U32_10)
     {
-        len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%.*f", precision, val);
+        p_end -= 2;
+        memcpy(p_end, &g_jsg_digit_pairs[val * 2U], 2);
     }
     else
     {
-        if (precision < 0)
-        {
-            len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%1.7g", val);
+        p_end -= 1;
+        *p_end = (char)('0' + val);
+    }
+    return p_end;
+}
 
-            // Check if the original double value can be recovered
-            char*         p_end = NULL;
-            const float_t test  = strtof(p_str->buffer, &p_end);
-            if (*(const uint32_t*)&test != *(const uint32_t*)&val)
-            {
-                // If not, print with more decimal places of precision
-                len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%1.9g", val);
-            }
-        }
-        else
+/**
+ * @brief Prints the decimal digits of the value backwards from p_end.
+ * @details The 64-bit division is used only to split the value into 8-digit groups,
+ * which are printed with 32-bit arithmetic.
+ * @return Returns a pointer to the first digit.
+ */
+static char*
+jsg_u64_to_str_backward(uint64_t val, char* p_end)
+{
+    while (val > UINT32_MAX)
+    {
+        const uint64_t quotient = val / JSON_STREAM_GEN_CONST_U32_100000000;
+        uint32_t       group    = (uint32_t)(val - (quotient * JSON_STREAM_GEN_CONST_U32_100000000));
+        val                     = quotient;
+        for (uint32_t i = 0; i < 4; ++i)
         {
-            len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%1.*g", precision, val);
+            p_end -= 2;
+            memcpy(p_end, &g_jsg_digit_pairs[(group % JSON_STREAM_GEN_CONST_U32_100) * 2U], 2);
+            group /= JSON_STREAM_GEN_CONST_U32_100;
         }
     }
+    return jsg_u32_to_str_backward((uint32_t)val, p_end);
+}
 
-    if ((len < 0) || ((size_t)len >= sizeof(p_str->buffer)))
+static bool
+jsg_add_integer(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint64_t           abs_val,
+    const bool               flag_negative)
+{
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-
-    char* p_decimal_point = strchr(p_str->buffer, jsg_get_decimal_point(p_gen));
-    if (NULL != p_decimal_point)
+    jsg_int_str_buf_t int_str = { 0 };
+    char* const       p_end   = &int_str.buffer[sizeof(int_str.buffer)];
+    const char* const p_str   = jsg_u64_to_str_backward(abs_val, p_end);
+    if (flag_negative && (!jsg_append_char(p_gen, saved_chunk_buf_idx, '-')))
     {
-        *p_decimal_point = '.';
+        return false;
+    }
+    if (!jsg_append(p_gen, saved_chunk_buf_idx, p_str, (size_t)(p_end - p_str)))
+    {
+        return false;
     }
+    p_gen->is_first_item = false;
     return true;
 }
 
-static bool
-jsg_add_float_with_precision(
-    json_stream_gen_t* const                  p_gen,
-    const char* const                         p_name,
-    const float_t                             val,
-    const bool                                flag_fixed_point,
-    const json_stream_gen_ieee754_precision_t precision)
+bool
+json_stream_gen_add_int32(json_stream_gen_t* const p_gen, const char* const p_name, const int32_t val)
 {
-    p_gen->flag_new_data_added = true;
+    const bool flag_negative = val < 0;
+    return jsg_add_integer(p_gen, p_name, flag_negative ? (0U - (uint64_t)val) : (uint64_t)val, flag_negative);
+}
 
-    jsg_float_str_buf_t float_str = { 0 };
-    if (!jsg_float_to_str(p_gen, val, flag_fixed_point, precision, &float_str))
-    {
-        return json_stream_gen_add_null(p_gen, p_name);
-    }
+bool
+json_stream_gen_add_uint32(json_stream_gen_t* const p_gen, const char* const p_name, const uint32_t val)
+{
+    return jsg_add_integer(p_gen, p_name, val, false);
+}
+
+bool
+json_stream_gen_add_int64(json_stream_gen_t* const p_gen, const char* const p_name, const int64_t val)
+{
+    const bool flag_negative = val < 0;
+    return jsg_add_integer(p_gen, p_name, flag_negative ? (0U - (uint64_t)val) : (uint64_t)val, flag_negative);
+}
+
+bool
+json_stream_gen_add_uint64(json_stream_gen_t* const p_gen, const char* const p_name, const uint64_t val)
+{
+    return jsg_add_integer(p_gen, p_name, val, false);
+}
 
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
+bool
+json_stream_gen_add_bool(json_stream_gen_t* const p_gen, const char* const p_name, const bool val)
+{
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s", float_str.buffer))
+    if (!jsg_append_str(p_gen, saved_chunk_buf_idx, val ? "true" : "false"))
     {
         return false;
     }
@@ -800,24 +1565,522 @@ jsg_add_float_with_precision(
     return true;
 }
 
-typedef struct jsg_double_str_buf_t
-{
-    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_DOUBLE];
-} jsg_double_str_buf_t;
-
-static bool
-jsg_double_to_str(
-    const json_stream_gen_t* const            p_gen,
-    const double_t                            val,
-    const bool                                flag_fixed_point,
-    const json_stream_gen_ieee754_precision_t precision,
-    jsg_double_str_buf_t* const               p_str)
+bool
+json_stream_gen_add_null(json_stream_gen_t* const p_gen, const char* const p_name)
 {
-    if ((0 != isnan(val)) || (0 != isinf(val)))
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    jsg_int_t len = 0;
+    if (!jsg_append(p_gen, saved_chunk_buf_idx, "null", 4))
+    {
+        return false;
+    }
+    p_gen->is_first_item = false;
+    return true;
+}
+
+/**
+ * @brief A floating-point number with 64-bit significand: f * 2^e (the "do-it-yourself" floating point of Grisu).
+ */
+typedef struct jsg_diy_fp_t
+{
+    uint64_t f;
+    int32_t  e;
+} jsg_diy_fp_t;
+
+typedef struct jsg_cached_power_t
+{
+    uint64_t f;
+    int16_t  e;
+} jsg_cached_power_t;
+
+#define JSG_GRISU_MAX_DIGITS          (17U)
+#define JSG_GRISU_CACHED_POWERS_MIN_K (-348)
+#define JSG_GRISU_CACHED_POWERS_STEP  (8)
+#define JSG_GRISU_DIY_SIGNIFICAND_BITS (64)
+
+/**
+ * @brief Normalized 64-bit approximations of 10^k for k = -348, -340, ..., 340.
+ */
+static const jsg_cached_power_t g_jsg_cached_powers[] = {
+    { 0xFA8FD5A0081C0288ULL, -1220 }, { 0xBAAEE17FA23EBF76ULL, -1193 }, { 0x8B16FB203055AC76ULL, -1166 },
+    { 0xCF42894A5DCE35EAULL, -1140 }, { 0x9A6BB0AA55653B2DULL, -1113 }, { 0xE61ACF033D1A45DFULL, -1087 },
+    { 0xAB70FE17C79AC6CAULL, -1060 }, { 0xFF77B1FCBEBCDC4FULL, -1034 }, { 0xBE5691EF416BD60CULL, -1007 },
+    { 0x8DD01FAD907FFC3CULL, -980 }, { 0xD3515C2831559A83ULL, -954 }, { 0x9D71AC8FADA6C9B5ULL, -927 },
+    { 0xEA9C227723EE8BCBULL, -901 }, { 0xAECC49914078536DULL, -874 }, { 0x823C12795DB6CE57ULL, -847 },
+    { 0xC21094364DFB5637ULL, -821 }, { 0x9096EA6F3848984FULL, -794 }, { 0xD77485CB25823AC7ULL, -768 },
+    { 0xA086CFCD97BF97F4ULL, -741 }, { 0xEF340A98172AACE5ULL, -715 }, { 0xB23867FB2A35B28EULL, -688 },
+    { 0x84C8D4DFD2C63F3BULL, -661 }, { 0xC5DD44271AD3CDBAULL, -635 }, { 0x936B9FCEBB25C996ULL, -608 },
+    { 0xDBAC6C247D62A584ULL, -582 }, { 0xA3AB66580D5FDAF6ULL, -555 }, { 0xF3E2F893DEC3F126ULL, -529 },
+    { 0xB5B5ADA8AAFF80B8ULL, -502 }, { 0x87625F056C7C4A8BULL, -475 }, { 0xC9BCFF6034C13053ULL, -449 },
+    { 0x964E858C91BA2655ULL, -422 }, { 0xDFF9772470297EBDULL, -396 }, { 0xA6DFBD9FB8E5B88FULL, -369 },
+    { 0xF8A95FCF88747D94ULL, -343 }, { 0xB94470938FA89BCFULL, -316 }, { 0x8A08F0F8BF0F156BULL, -289 },
+    { 0xCDB02555653131B6ULL, -263 }, { 0x993FE2C6D07B7FACULL, -236 }, { 0xE45C10C42A2B3B06ULL, -210 },
+    { 0xAA242499697392D3ULL, -183 }, { 0xFD87B5F28300CA0EULL, -157 }, { 0xBCE5086492111AEBULL, -130 },
+    { 0x8CBCCC096F5088CCULL, -103 }, { 0xD1B71758E219652CULL, -77 }, { 0x9C40000000000000ULL, -50 },
+    { 0xE8D4A51000000000ULL, -24 }, { 0xAD78EBC5AC620000ULL, 3 }, { 0x813F3978F8940984ULL, 30 },
+    { 0xC097CE7BC90715B3ULL, 56 }, { 0x8F7E32CE7BEA5C70ULL, 83 }, { 0xD5D238A4ABE98068ULL, 109 },
+    { 0x9F4F2726179A2245ULL, 136 }, { 0xED63A231D4C4FB27ULL, 162 }, { 0xB0DE65388CC8ADA8ULL, 189 },
+    { 0x83C7088E1AAB65DBULL, 216 }, { 0xC45D1DF942711D9AULL, 242 }, { 0x924D692CA61BE758ULL, 269 },
+    { 0xDA01EE641A708DEAULL, 295 }, { 0xA26DA3999AEF774AULL, 322 }, { 0xF209787BB47D6B85ULL, 348 },
+    { 0xB454E4A179DD1877ULL, 375 }, { 0x865B86925B9BC5C2ULL, 402 }, { 0xC83553C5C8965D3DULL, 428 },
+    { 0x952AB45CFA97A0B3ULL, 455 }, { 0xDE469FBD99A05FE3ULL, 481 }, { 0xA59BC234DB398C25ULL, 508 },
+    { 0xF6C69A72A3989F5CULL, 534 }, { 0xB7DCBF5354E9BECEULL, 561 }, { 0x88FCF317F22241E2ULL, 588 },
+    { 0xCC20CE9BD35C78A5ULL, 614 }, { 0x98165AF37B2153DFULL, 641 }, { 0xE2A0B5DC971F303AULL, 667 },
+    { 0xA8D9D1535CE3B396ULL, 694 }, { 0xFB9B7CD9A4A7443CULL, 720 }, { 0xBB764C4CA7A44410ULL, 747 },
+    { 0x8BAB8EEFB6409C1AULL, 774 }, { 0xD01FEF10A657842CULL, 800 }, { 0x9B10A4E5E9913129ULL, 827 },
+    { 0xE7109BFBA19C0C9DULL, 853 }, { 0xAC2820D9623BF429ULL, 880 }, { 0x80444B5E7AA7CF85ULL, 907 },
+    { 0xBF21E44003ACDD2DULL, 933 }, { 0x8E679C2F5E44FF8FULL, 960 }, { 0xD433179D9C8CB841ULL, 986 },
+    { 0x9E19DB92B4E31BA9ULL, 1013 }, { 0xEB96BF6EBADF77D9ULL, 1039 }, { 0xAF87023B9BF0EE6BULL, 1066 },
+};
+
+static const uint32_t g_jsg_pow10_u32[] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U,
+};
+
+static jsg_diy_fp_t
+jsg_diy_fp_mul(const jsg_diy_fp_t x, const jsg_diy_fp_t y)
+{
+    const uint64_t mask_32 = 0xFFFFFFFFU;
+    const uint64_t a       = x.f >> 32U;
+    const uint64_t b       = x.f & mask_32;
+    const uint64_t c       = y.f >> 32U;
+    const uint64_t d       = y.f & mask_32;
+    const uint64_t ac      = a * c;
+    const uint64_t bc      = b * c;
+    const uint64_t ad      = a * d;
+    const uint64_t bd      = b * d;
+    uint64_t       tmp     = (bd >> 32U) + (ad & mask_32) + (bc & mask_32);
+    tmp += 1U << 31U; // Round the result
+    const jsg_diy_fp_t res = {
+        .f = ac + (ad >> 32U) + (bc >> 32U) + (tmp >> 32U),
+        .e = x.e + y.e + JSG_GRISU_DIY_SIGNIFICAND_BITS,
+    };
+    return res;
+}
+
+static jsg_diy_fp_t
+jsg_diy_fp_normalize(const jsg_diy_fp_t x)
+{
+    const int32_t      shift = __builtin_clzll(x.f);
+    const jsg_diy_fp_t res   = {
+          .f = x.f << (uint32_t)shift,
+          .e = x.e - shift,
+    };
+    return res;
+}
+
+/**
+ * @brief Returns the cached power 10^-k, such that the product of it and a number with the binary exponent e
+ * has the binary exponent in the range [-60, -32], which is required by jsg_grisu_digit_gen.
+ */
+static jsg_diy_fp_t
+jsg_grisu_get_cached_power(const int32_t e, int32_t* const p_k)
+{
+    const double_t dk = ((double_t)(-61 - e) * 0.30102999566398114) + 347; // log10(2)
+    int32_t        k  = (int32_t)dk;
+    if ((dk - (double_t)k) > 0.0)
+    {
+        k += 1;
+    }
+    const uint32_t idx = ((uint32_t)k >> 3U) + 1U;
+    *p_k               = -(JSG_GRISU_CACHED_POWERS_MIN_K + ((int32_t)idx * JSG_GRISU_CACHED_POWERS_STEP));
+    const jsg_diy_fp_t res = {
+        .f = g_jsg_cached_powers[idx].f,
+        .e = g_jsg_cached_powers[idx].e,
+    };
+    return res;
+}
+
+static uint32_t
+jsg_count_decimal_digits_u32(const uint32_t val)
+{
+    uint32_t num_digits = 1;
+    while ((num_digits < (sizeof(g_jsg_pow10_u32) / sizeof(g_jsg_pow10_u32[0])))
+           && (val >= g_jsg_pow10_u32[num_digits]))
+    {
+        num_digits += 1;
+    }
+    return num_digits;
+}
+
+/**
+ * @brief Moves the last digit towards w while the result stays within the unsafe interval (Grisu3).
+ * @return Returns false if it's not certain that the digits are the closest ones to the value
+ * which are within the rounding interval.
+ */
+static bool
+jsg_grisu_round_weed(
+    char* const    p_digits,
+    const uint32_t num_digits,
+    const uint64_t dist_too_high_w,
+    const uint64_t unsafe_interval,
+    uint64_t       rest,
+    const uint64_t ten_kappa,
+    const uint64_t unit)
+{
+    const uint64_t small_dist = dist_too_high_w - unit;
+    const uint64_t big_dist   = dist_too_high_w + unit;
+    while ((rest < small_dist) && ((unsafe_interval - rest) >= ten_kappa)
+           && (((rest + ten_kappa) < small_dist) || ((small_dist - rest) >= ((rest + ten_kappa) - small_dist))))
+    {
+        p_digits[num_digits - 1] -= 1;
+        rest += ten_kappa;
+    }
+    if ((rest < big_dist) && ((unsafe_interval - rest) >= ten_kappa)
+        && (((rest + ten_kappa) < big_dist) || ((big_dist - rest) > ((rest + ten_kappa) - big_dist))))
+    {
+        return false;
+    }
+    // The digits must be safely inside the rounding interval, the boundaries are left for the exact fallback.
+    return ((2U * unit) <= rest) && (rest <= (unsafe_interval - (4U * unit)));
+}
+
+/**
+ * @brief Generates the shortest digits within the rounding interval (low, high) which are the closest to w.
+ * @details The scaled values have an error of up to one unit, so the digits are generated for the wider
+ * (unsafe) interval, and the result is rejected if it may be outside of the exact interval.
+ * @return Returns false if the result is not guaranteed to be the shortest and the closest one.
+ */
+static bool
+jsg_grisu_digit_gen(
+    const jsg_diy_fp_t low,
+    const jsg_diy_fp_t w,
+    const jsg_diy_fp_t high,
+    char* const        p_digits,
+    uint32_t* const    p_num_digits,
+    int32_t* const     p_k)
+{
+    uint64_t       unit            = 1U;
+    const uint64_t too_high        = high.f + unit;
+    uint64_t       unsafe_interval = too_high - (low.f - unit);
+    const uint32_t shift           = (uint32_t)-w.e;
+    const uint64_t one             = (uint64_t)1U << shift;
+    uint32_t       integrals       = (uint32_t)(too_high >> shift);
+    uint64_t       fractionals     = too_high & (one - 1U);
+    int32_t        kappa           = (int32_t)jsg_count_decimal_digits_u32(integrals);
+    uint32_t       num_digits      = 0;
+    while (kappa > 0)
+    {
+        const uint32_t divisor = g_jsg_pow10_u32[kappa - 1];
+        p_digits[num_digits]   = (char)('0' + (integrals / divisor));
+        num_digits += 1;
+        integrals %= divisor;
+        kappa -= 1;
+        const uint64_t rest = ((uint64_t)integrals << shift) + fractionals;
+        if (rest < unsafe_interval)
+        {
+            *p_num_digits = num_digits;
+            *p_k += kappa;
+            return jsg_grisu_round_weed(
+                p_digits,
+                num_digits,
+                too_high - w.f,
+                unsafe_interval,
+                rest,
+                (uint64_t)divisor << shift,
+                unit);
+        }
+    }
+    while (num_digits < JSG_GRISU_MAX_DIGITS)
+    {
+        fractionals *= JSON_STREAM_GEN_CONST_U32_10;
+        unit *= JSON_STREAM_GEN_CONST_U32_10;
+        unsafe_interval *= JSON_STREAM_GEN_CONST_U32_10;
+        p_digits[num_digits] = (char)('0' + (fractionals >> shift));
+        num_digits += 1;
+        fractionals &= one - 1U;
+        kappa -= 1;
+        if (fractionals < unsafe_interval)
+        {
+            *p_num_digits = num_digits;
+            *p_k += kappa;
+            return jsg_grisu_round_weed(
+                p_digits,
+                num_digits,
+                (too_high - w.f) * unit,
+                unsafe_interval,
+                fractionals,
+                one,
+                unit);
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Generates the shortest decimal digits which are converted back to the same binary value (Grisu3).
+ * @details Any IEEE 754 binary format is supported: the value is represented by its significand
+ * (with the hidden bit), binary exponent and the boundaries of the rounding interval.
+ * @param significand is the significand of the positive finite non-zero value.
+ * @param exponent is the binary exponent of the value.
+ * @param flag_lower_boundary_is_closer is true if the significand is a power of two (the lower neighbour is closer).
+ * @param p_digits is the output buffer for at least JSG_GRISU_MAX_DIGITS digits.
+ * @param p_num_digits is the output number of digits.
+ * @param p_k is the output decimal exponent: value = digits * 10^k.
+ * @return Returns false if the shortest digits can't be found this way (about 0.5% of the values),
+ * then the result must be obtained in another way.
+ */
+static bool
+jsg_grisu3(
+    const uint64_t  significand,
+    const int32_t   exponent,
+    const bool      flag_lower_boundary_is_closer,
+    char* const     p_digits,
+    uint32_t* const p_num_digits,
+    int32_t* const  p_k)
+{
+    const jsg_diy_fp_t v       = { .f = significand, .e = exponent };
+    const jsg_diy_fp_t m_plus  = jsg_diy_fp_normalize((jsg_diy_fp_t) { .f = (v.f << 1U) + 1U, .e = v.e - 1 });
+    jsg_diy_fp_t       m_minus = flag_lower_boundary_is_closer ? (jsg_diy_fp_t) { .f = (v.f << 2U) - 1U, .e = v.e - 2 }
+                                                               : (jsg_diy_fp_t) { .f = (v.f << 1U) - 1U, .e = v.e - 1 };
+    m_minus.f <<= (uint32_t)(m_minus.e - m_plus.e);
+    m_minus.e = m_plus.e;
+
+    int32_t            k    = 0;
+    const jsg_diy_fp_t c_mk = jsg_grisu_get_cached_power(m_plus.e, &k);
+    const jsg_diy_fp_t w    = jsg_diy_fp_mul(jsg_diy_fp_normalize(v), c_mk);
+    const jsg_diy_fp_t w_p  = jsg_diy_fp_mul(m_plus, c_mk);
+    const jsg_diy_fp_t w_m  = jsg_diy_fp_mul(m_minus, c_mk);
+    *p_k                    = k;
+    return jsg_grisu_digit_gen(w_m, w, w_p, p_digits, p_num_digits, p_k);
+}
+
+/**
+ * @brief Generates the shortest digits by printing the value with an increasing precision
+ * until it's converted back to the same value.
+ * @details This is the exact fallback for the values rejected by Grisu3: printf rounds correctly,
+ * and strtod resolves the ties on the boundaries of the rounding interval to even as the JSON parsers do.
+ * @param val is the positive finite non-zero value.
+ * @param flag_single_precision is true if the value is a float.
+ * @param max_digits is the number of digits which is always enough to restore the value.
+ * @param p_digits is the output buffer for at least JSG_GRISU_MAX_DIGITS digits.
+ * @param p_k is the output decimal exponent: value = digits * 10^k.
+ * @return Returns the number of digits.
+ */
+static uint32_t
+jsg_print_shortest_digits_exactly(
+    const double_t val,
+    const bool     flag_single_precision,
+    const uint32_t max_digits,
+    char* const    p_digits,
+    int32_t* const p_k)
+{
+    char buf[JSON_STREAM_GEN_STR_BUF_SIZE_DOUBLE] = { '\0' };
+    for (uint32_t precision = 1;; ++precision)
+    {
+        (void)snprintf(buf, sizeof(buf), "%.*e", (jsg_int_t)precision - 1, val);
+        const bool flag_round_trip = flag_single_precision ? (strtof(buf, NULL) == (float_t)val)
+                                                           : (strtod(buf, NULL) == val);
+        if (flag_round_trip || (precision >= max_digits))
+        {
+            break;
+        }
+    }
+    // The decimal point depends on the locale, so only the digits are taken from the mantissa.
+    uint32_t    num_digits = 0;
+    const char* p_ch       = buf;
+    for (; 'e' != *p_ch; ++p_ch)
+    {
+        if ((*p_ch >= '0') && (*p_ch <= '9'))
+        {
+            p_digits[num_digits] = *p_ch;
+            num_digits += 1;
+        }
+    }
+    *p_k = (int32_t)strtol(p_ch + 1, NULL, JSON_STREAM_GEN_CONST_U32_10) - ((int32_t)num_digits - 1);
+    return num_digits;
+}
+
+/**
+ * @brief Prints the digits in the same layout as printf("%.*g", precision) does.
+ * @details The exponential notation is used if the decimal exponent is less than -4
+ * or greater than or equal to the precision.
+ * @return Returns the length of the string (without the terminating null).
+ */
+static size_t
+jsg_print_digits_as_g(
+    const bool        flag_negative,
+    const char* const p_digits,
+    const uint32_t    num_digits,
+    const int32_t     k,
+    const int32_t     precision,
+    char* const       p_buf)
+{
+    const int32_t exp10 = k + (int32_t)num_digits - 1;
+    size_t        len   = 0;
+    if (flag_negative)
+    {
+        p_buf[len++] = '-';
+    }
+    if ((exp10 < -4) || (exp10 >= precision))
+    {
+        p_buf[len++] = p_digits[0];
+        if (num_digits > 1)
+        {
+            p_buf[len++] = '.';
+            memcpy(&p_buf[len], &p_digits[1], num_digits - 1);
+            len += num_digits - 1;
+        }
+        p_buf[len++]            = 'e';
+        p_buf[len++]            = (exp10 < 0) ? '-' : '+';
+        const uint32_t abs_exp  = (uint32_t)((exp10 < 0) ? -exp10 : exp10);
+        if (abs_exp >= JSON_STREAM_GEN_CONST_U32_100)
+        {
+            p_buf[len++] = (char)('0' + (abs_exp / JSON_STREAM_GEN_CONST_U32_100));
+        }
+        memcpy(&p_buf[len], &g_jsg_digit_pairs[(abs_exp % JSON_STREAM_GEN_CONST_U32_100) * 2U], 2);
+        len += 2;
+    }
+    else if (exp10 < 0)
+    {
+        p_buf[len++] = '0';
+        p_buf[len++] = '.';
+        for (int32_t i = -1; i > exp10; --i)
+        {
+            p_buf[len++] = '0';
+        }
+        memcpy(&p_buf[len], p_digits, num_digits);
+        len += num_digits;
+    }
+    else if ((uint32_t)exp10 >= (num_digits - 1))
+    {
+        memcpy(&p_buf[len], p_digits, num_digits);
+        len += num_digits;
+        for (uint32_t i = num_digits - 1; i < (uint32_t)exp10; ++i)
+        {
+            p_buf[len++] = '0';
+        }
+    }
+    else
+    {
+        const uint32_t num_int_digits = (uint32_t)exp10 + 1U;
+        memcpy(&p_buf[len], p_digits, num_int_digits);
+        len += num_int_digits;
+        p_buf[len++] = '.';
+        memcpy(&p_buf[len], &p_digits[num_int_digits], num_digits - num_int_digits);
+        len += num_digits - num_int_digits;
+    }
+    p_buf[len] = '\0';
+    return len;
+}
+
+#define JSON_STREAM_GEN_FLOAT_PRECISION_SHORT  (7)
+#define JSON_STREAM_GEN_FLOAT_PRECISION_LONG   (9)
+#define JSON_STREAM_GEN_DOUBLE_PRECISION_SHORT (15)
+#define JSON_STREAM_GEN_DOUBLE_PRECISION_LONG  (17)
+
+#define JSG_FLOAT_SIGNIFICAND_BITS  (23U)
+#define JSG_FLOAT_EXPONENT_MASK     (0xFFU)
+#define JSG_FLOAT_EXPONENT_BIAS     (127 + 23)
+#define JSG_DOUBLE_SIGNIFICAND_BITS (52U)
+#define JSG_DOUBLE_EXPONENT_MASK    (0x7FFU)
+#define JSG_DOUBLE_EXPONENT_BIAS    (1023 + 52)
+
+/**
+ * @brief Prints the shortest representation of the finite value which is converted back to the same value.
+ * @details The number of significant digits is not more than 9 for float and 17 for double, and the layout
+ * is the same as printf("%.*g") uses with the precision of 7 (15 for double) digits
+ * or 9 (17 for double) digits if more digits are needed.
+ * The digits are generated with Grisu3, the rare values which it can't handle are printed with printf.
+ * @param val is the value, it's used only by the fallback to printf.
+ * @param bits is the binary representation of the value.
+ * @return Returns the length of the string (without the terminating null).
+ */
+static size_t
+jsg_print_shortest(
+    const double_t val,
+    const uint64_t bits,
+    const uint32_t significand_bits,
+    const uint32_t exponent_mask,
+    const int32_t  exponent_bias,
+    const int32_t  precision_short,
+    const int32_t  precision_long,
+    char* const    p_buf)
+{
+    const uint64_t hidden_bit      = (uint64_t)1U << significand_bits;
+    const uint64_t significand     = bits & (hidden_bit - 1U);
+    const uint32_t biased_exponent = (uint32_t)(bits >> significand_bits) & exponent_mask;
+    const bool     flag_negative   = 0 != ((bits >> significand_bits) & (exponent_mask + 1U));
+    if ((0 == biased_exponent) && (0 == significand))
+    {
+        if (flag_negative)
+        {
+            memcpy(p_buf, "-0", 3);
+            return 2;
+        }
+        memcpy(p_buf, "0", 2);
+        return 1;
+    }
+    char     digits[JSG_GRISU_MAX_DIGITS + 1] = { '\0' };
+    int32_t  k                                = 0;
+    uint32_t num_digits                       = 0;
+    bool     flag_shortest                    = false;
+    if (0 == biased_exponent)
+    {
+        // Subnormal numbers
+        flag_shortest = jsg_grisu3(significand, 1 - exponent_bias, false, digits, &num_digits, &k);
+    }
+    else
+    {
+        flag_shortest = jsg_grisu3(
+            significand | hidden_bit,
+            (int32_t)biased_exponent - exponent_bias,
+            (0 == significand) && (biased_exponent > 1),
+            digits,
+            &num_digits,
+            &k);
+    }
+    if (!flag_shortest)
+    {
+        num_digits = jsg_print_shortest_digits_exactly(
+            fabs(val),
+            JSG_FLOAT_SIGNIFICAND_BITS == significand_bits,
+            (uint32_t)precision_long,
+            digits,
+            &k);
+    }
+    const int32_t precision = ((int32_t)num_digits <= precision_short) ? precision_short : precision_long;
+    return jsg_print_digits_as_g(flag_negative, digits, num_digits, k, precision, p_buf);
+}
+
+/**
+ * @brief Replaces the locale-specific decimal point printed by snprintf with '.'.
+ */
+static void
+jsg_fix_decimal_point(const json_stream_gen_t* const p_gen, char* const p_buf)
+{
+    if ('.' == p_gen->decimal_point)
+    {
+        return;
+    }
+    char* const p_decimal_point = strchr(p_buf, p_gen->decimal_point);
+    if (NULL != p_decimal_point)
+    {
+        *p_decimal_point = '.';
+    }
+}
+
+typedef struct jsg_float_str_buf_t
+{
+    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_FLOAT];
+} jsg_float_str_buf_t;
+
+static bool
+jsg_float_to_str(
+    const json_stream_gen_t* const            p_gen,
+    const float_t                             val,
+    const bool                                flag_fixed_point,
+    const json_stream_gen_ieee754_precision_t precision,
+    jsg_float_str_buf_t* const                p_str)
+{
+    if ((0 != isnanf(val)) || (0 != isinff(val)))
+    {
+        return false;
+    }
+    jsg_int_t len = 0;
     if (flag_fixed_point)
     {
         len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%.*f", precision, val);
@@ -826,16 +2089,19 @@ jsg_double_to_str(
     {
         if (precision < 0)
         {
-            len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%1.15g", val);
-
-            // Check if the original double value can be recovered
-            char*          p_end = NULL;
-            const double_t test  = strtod(p_str->buffer, &p_end);
-            if (*(const uint64_t*)&test != *(const uint64_t*)&val)
-            {
-                // If not, print with more decimal places of precision
-                len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%1.17g", val);
-            }
+            const float_t val_f = val;
+            uint32_t      bits  = 0;
+            memcpy(&bits, &val_f, sizeof(bits));
+            (void)jsg_print_shortest(
+                val_f,
+                bits,
+                JSG_FLOAT_SIGNIFICAND_BITS,
+                JSG_FLOAT_EXPONENT_MASK,
+                JSG_FLOAT_EXPONENT_BIAS,
+                JSON_STREAM_GEN_FLOAT_PRECISION_SHORT,
+                JSON_STREAM_GEN_FLOAT_PRECISION_LONG,
+                p_str->buffer);
+            return true; // The shortest representation is printed without using the locale.
         }
         else
         {
@@ -848,11 +2114,95 @@ jsg_double_to_str(
         return false;
     }
 
-    char* p_decimal_point = strchr(p_str->buffer, jsg_get_decimal_point(p_gen));
-    if (NULL != p_decimal_point)
+    jsg_fix_decimal_point(p_gen, p_str->buffer);
+    return true;
+}
+
+static bool
+jsg_add_float_with_precision(
+    json_stream_gen_t* const                  p_gen,
+    const char* const                         p_name,
+    const float_t                             val,
+    const bool                                flag_fixed_point,
+    const json_stream_gen_ieee754_precision_t precision)
+{
+    p_gen->flag_new_data_added = true;
+    if (jsg_is_chunk_closed(p_gen))
     {
-        *p_decimal_point = '.';
+        return false;
+    }
+
+    jsg_float_str_buf_t float_str = { 0 };
+    if (!jsg_float_to_str(p_gen, val, flag_fixed_point, precision, &float_str))
+    {
+        return json_stream_gen_add_null(p_gen, p_name);
+    }
+
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
+    {
+        return false;
+    }
+    if (!jsg_append_str(p_gen, saved_chunk_buf_idx, float_str.buffer))
+    {
+        return false;
+    }
+    p_gen->is_first_item = false;
+    return true;
+}
+
+typedef struct jsg_double_str_buf_t
+{
+    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_DOUBLE];
+} jsg_double_str_buf_t;
+
+static bool
+jsg_double_to_str(
+    const json_stream_gen_t* const            p_gen,
+    const double_t                            val,
+    const bool                                flag_fixed_point,
+    const json_stream_gen_ieee754_precision_t precision,
+    jsg_double_str_buf_t* const               p_str)
+{
+    if ((0 != isnan(val)) || (0 != isinf(val)))
+    {
+        return false;
+    }
+    jsg_int_t len = 0;
+    if (flag_fixed_point)
+    {
+        len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%.*f", precision, val);
+    }
+    else
+    {
+        if (precision < 0)
+        {
+            const double val_d = val;
+            uint64_t     bits  = 0;
+            memcpy(&bits, &val_d, sizeof(bits));
+            (void)jsg_print_shortest(
+                val_d,
+                bits,
+                JSG_DOUBLE_SIGNIFICAND_BITS,
+                JSG_DOUBLE_EXPONENT_MASK,
+                JSG_DOUBLE_EXPONENT_BIAS,
+                JSON_STREAM_GEN_DOUBLE_PRECISION_SHORT,
+                JSON_STREAM_GEN_DOUBLE_PRECISION_LONG,
+                p_str->buffer);
+            return true; // The shortest representation is printed without using the locale.
+        }
+        else
+        {
+            len = snprintf(p_str->buffer, sizeof(p_str->buffer), "%1.*g", precision, val);
+        }
+    }
+
+    if ((len < 0) || ((size_t)len >= sizeof(p_str->buffer)))
+    {
+        return false;
     }
+
+    jsg_fix_decimal_point(p_gen, p_str->buffer);
     return true;
 }
 
@@ -865,18 +2215,22 @@ jsg_add_double_with_precision(
     json_stream_gen_ieee754_precision_t precision)
 {
     p_gen->flag_new_data_added = true;
+    if (jsg_is_chunk_closed(p_gen))
+    {
+        return false;
+    }
 
     jsg_double_str_buf_t double_str = { 0 };
     if (!jsg_double_to_str(p_gen, val, flag_fixed_point, precision, &double_str))
     {
         return json_stream_gen_add_null(p_gen, p_name);
     }
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s", double_str.buffer))
+    if (!jsg_append_str(p_gen, saved_chunk_buf_idx, double_str.buffer))
     {
         return false;
     }
@@ -924,16 +2278,29 @@ json_stream_gen_add_double_fixed_point(
     return jsg_add_double_with_precision(p_gen, p_name, val, true, (json_stream_gen_ieee754_precision_t)num_decimals);
 }
 
-typedef struct jsg_limited_float_str_buf_t
+/**
+ * @brief Defines a fixed-point number, which is printed as
+ * [sign]<integral_part><num_zeros zeros>[.<fractional_part padded with zeros to num_decimals digits>].
+ */
+typedef struct jsg_fixed_point_t
+{
+    uint64_t integral_part;
+    uint64_t fractional_part;
+    uint32_t num_zeros;
+    uint32_t num_decimals;
+    bool     flag_negative;
+} jsg_fixed_point_t;
+
+typedef struct jsg_fixed_point_str_buf_t
 {
-    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_LIMITED_FLOAT];
-} jsg_limited_float_str_buf_t;
+    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_FIXED_POINT];
+} jsg_fixed_point_str_buf_t;
 
 static bool
-jsg_limited_float_to_str(
+jsg_limited_float_to_fixed_point(
     const float_t                              val,
     const json_stream_gen_num_decimals_float_e num_decimals,
-    jsg_limited_float_str_buf_t* const         p_str)
+    jsg_fixed_point_t* const                   p_fixed_point)
 {
     static const uint32_t g_multipliers_u32[JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_6 + 1] = {
         (uint32_t)1e+0, (uint32_t)1e+1, (uint32_t)1e+2, (uint32_t)1e+3, (uint32_t)1e+4, (uint32_t)1e+5, (uint32_t)1e+6,
@@ -954,7 +2321,7 @@ jsg_limited_float_to_str(
     }
 
     uint32_t multiplier  = g_multipliers_u32[num_decimals];
-    int32_t  divider_cnt = 0;
+    uint32_t divider_cnt = 0;
     float_t  divider     = JSON_STREAM_GEN_CONST_FLOAT_1;
     while (((abs_val * (float_t)multiplier) / divider) > (float_t)(1U << (uint32_t)FLT_MANT_DIG))
     {
@@ -968,83 +2335,30 @@ jsg_limited_float_to_str(
             divider *= JSON_STREAM_GEN_CONST_FLOAT_10;
         }
     }
-    const char zeros_str[] = "000";
-    if (divider_cnt >= (int32_t)(sizeof(zeros_str)))
+    if (divider_cnt > JSON_STREAM_GEN_LIMITED_FLOAT_MAX_NUM_ZEROS)
     {
         return false;
     }
 
     const uint32_t val_u32         = (uint32_t)lrintf((abs_val * (float_t)multiplier) / divider);
-    const uint32_t integral_part   = val_u32 / multiplier;
-    const uint32_t fractional_part = val_u32 % multiplier;
-
-    json_stream_gen_num_decimals_t actual_num_decimals = 0;
+    p_fixed_point->integral_part   = val_u32 / multiplier;
+    p_fixed_point->fractional_part = val_u32 % multiplier;
+    p_fixed_point->num_zeros       = divider_cnt;
+    p_fixed_point->num_decimals    = 0;
+    p_fixed_point->flag_negative   = (val < 0);
     while (multiplier > 1)
     {
         multiplier /= JSON_STREAM_GEN_CONST_U32_10;
-        actual_num_decimals += 1;
-    }
-
-    const jsg_int_t len = snprintf(
-        p_str->buffer,
-        sizeof(p_str->buffer),
-        "%s"
-        "%" PRIu32
-        "%.*s"
-        "%s"
-        "%.*" PRIu32,
-        (val < 0) ? "-" : "",
-        integral_part,
-        divider_cnt,
-        zeros_str,
-        (0 != actual_num_decimals) ? "." : "",
-        actual_num_decimals,
-        fractional_part);
-    if ((len < 0) || ((size_t)len >= sizeof(p_str->buffer)))
-    {
-        return false;
+        p_fixed_point->num_decimals += 1;
     }
     return true;
 }
 
-bool
-json_stream_gen_add_float_limited_fixed_point(
-    json_stream_gen_t* const                   p_gen,
-    const char* const                          p_name,
-    const float_t                              val,
-    const json_stream_gen_num_decimals_float_e num_decimals)
-{
-    p_gen->flag_new_data_added = true;
-
-    jsg_limited_float_str_buf_t float_str = { 0 };
-    if (!jsg_limited_float_to_str(val, num_decimals, &float_str))
-    {
-        return json_stream_gen_add_null(p_gen, p_name);
-    }
-
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
-    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
-    {
-        return false;
-    }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s", float_str.buffer))
-    {
-        return false;
-    }
-    p_gen->is_first_item = false;
-    return true;
-}
-
-typedef struct jsg_limited_double_str_buf_t
-{
-    char buffer[JSON_STREAM_GEN_STR_BUF_SIZE_LIMITED_DOUBLE];
-} jsg_limited_double_str_buf_t;
-
-static bool
-jsg_limited_double_to_str(
-    const double_t                              val,
-    const json_stream_gen_num_decimals_double_e num_decimals,
-    jsg_limited_double_str_buf_t* const         p_str)
+static bool
+jsg_limited_double_to_fixed_point(
+    const double_t                              val,
+    const json_stream_gen_num_decimals_double_e num_decimals,
+    jsg_fixed_point_t* const                    p_fixed_point)
 {
     static const uint64_t g_multipliers_u64[JSON_STREAM_GEN_NUM_DECIMALS_DOUBLE_12 + 1] = {
         (uint64_t)1e+0,  (uint64_t)1e+1,  (uint64_t)1e+2,  (uint64_t)1e+3, (uint64_t)1e+4,
@@ -1067,7 +2381,7 @@ jsg_limited_double_to_str(
     }
 
     uint64_t multiplier  = g_multipliers_u64[num_decimals];
-    int32_t  divider_cnt = 0;
+    uint32_t divider_cnt = 0;
     double_t divider     = JSON_STREAM_GEN_CONST_DOUBLE_1;
     while (((abs_val * (double_t)multiplier) / divider) > (double_t)(1LLU << (uint32_t)DBL_MANT_DIG))
     {
@@ -1081,45 +2395,100 @@ jsg_limited_double_to_str(
             divider *= JSON_STREAM_GEN_CONST_DOUBLE_10;
         }
     }
-    const char zeros_str[] = "0000";
-    if (divider_cnt >= (int32_t)(sizeof(zeros_str)))
+    if (divider_cnt > JSON_STREAM_GEN_LIMITED_DOUBLE_MAX_NUM_ZEROS)
     {
         return false;
     }
 
     const uint64_t val_u64         = (uint64_t)lrint((abs_val * (double_t)multiplier) / divider);
-    const uint64_t integral_part   = val_u64 / multiplier;
-    const uint64_t fractional_part = val_u64 % multiplier;
-
-    json_stream_gen_num_decimals_t actual_num_decimals = 0;
+    p_fixed_point->integral_part   = val_u64 / multiplier;
+    p_fixed_point->fractional_part = val_u64 % multiplier;
+    p_fixed_point->num_zeros       = divider_cnt;
+    p_fixed_point->num_decimals    = 0;
+    p_fixed_point->flag_negative   = (val < 0);
     while (multiplier > 1)
     {
         multiplier /= JSON_STREAM_GEN_CONST_U32_10;
-        actual_num_decimals += 1;
-    }
-    const jsg_int_t len = snprintf(
-        p_str->buffer,
-        sizeof(p_str->buffer),
-        "%s"
-        "%" PRIu64
-        "%.*s"
-        "%s"
-        "%.*" PRIu64,
-        (val < 0) ? "-" : "",
-        integral_part,
-        divider_cnt,
-        zeros_str,
-        (0 != actual_num_decimals) ? "." : "",
-        actual_num_decimals,
-        fractional_part);
+        p_fixed_point->num_decimals += 1;
+    }
+    return true;
+}
 
-    if ((len < 0) || ((size_t)len >= sizeof(p_str->buffer)))
+/**
+ * @brief Prints the fixed-point number backwards from the end of the buffer with the integer kernels.
+ * @return Returns a pointer to the first character.
+ */
+static const char*
+jsg_fixed_point_to_str(const jsg_fixed_point_t* const p_fixed_point, jsg_fixed_point_str_buf_t* const p_str)
+{
+    char* const p_end = &p_str->buffer[sizeof(p_str->buffer)];
+    char*       p_pos = p_end;
+    if (0 != p_fixed_point->num_decimals)
+    {
+        p_pos                   = jsg_u64_to_str_backward(p_fixed_point->fractional_part, p_pos);
+        const size_t num_digits = (size_t)(p_end - p_pos);
+        if (num_digits < p_fixed_point->num_decimals)
+        {
+            p_pos -= p_fixed_point->num_decimals - num_digits;
+            memset(p_pos, '0', p_fixed_point->num_decimals - num_digits);
+        }
+        p_pos -= 1;
+        *p_pos = '.';
+    }
+    p_pos -= p_fixed_point->num_zeros;
+    memset(p_pos, '0', p_fixed_point->num_zeros);
+    p_pos = jsg_u64_to_str_backward(p_fixed_point->integral_part, p_pos);
+    if (p_fixed_point->flag_negative)
+    {
+        p_pos -= 1;
+        *p_pos = '-';
+    }
+    return p_pos;
+}
+
+static bool
+jsg_add_fixed_point(
+    json_stream_gen_t* const       p_gen,
+    const char* const              p_name,
+    const jsg_fixed_point_t* const p_fixed_point)
+{
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
+    jsg_fixed_point_str_buf_t fixed_point_str = { 0 };
+    const char* const         p_end           = &fixed_point_str.buffer[sizeof(fixed_point_str.buffer)];
+    const char* const         p_str           = jsg_fixed_point_to_str(p_fixed_point, &fixed_point_str);
+    if (!jsg_append(p_gen, saved_chunk_buf_idx, p_str, (size_t)(p_end - p_str)))
+    {
+        return false;
+    }
+    p_gen->is_first_item = false;
     return true;
 }
 
+bool
+json_stream_gen_add_float_limited_fixed_point(
+    json_stream_gen_t* const                   p_gen,
+    const char* const                          p_name,
+    const float_t                              val,
+    const json_stream_gen_num_decimals_float_e num_decimals)
+{
+    p_gen->flag_new_data_added = true;
+    if (jsg_is_chunk_closed(p_gen))
+    {
+        return false;
+    }
+
+    jsg_fixed_point_t fixed_point = { 0 };
+    if (!jsg_limited_float_to_fixed_point(val, num_decimals, &fixed_point))
+    {
+        return json_stream_gen_add_null(p_gen, p_name);
+    }
+    return jsg_add_fixed_point(p_gen, p_name, &fixed_point);
+}
+
 bool
 json_stream_gen_add_double_limited_fixed_point(
     json_stream_gen_t* const                    p_gen,
@@ -1128,24 +2497,130 @@ json_stream_gen_add_double_limited_fixed_point(
     const json_stream_gen_num_decimals_double_e num_decimals)
 {
     p_gen->flag_new_data_added = true;
+    if (jsg_is_chunk_closed(p_gen))
+    {
+        return false;
+    }
 
-    jsg_limited_double_str_buf_t double_str = { 0 };
-    if (!jsg_limited_double_to_str(val, num_decimals, &double_str))
+    jsg_fixed_point_t fixed_point = { 0 };
+    if (!jsg_limited_double_to_fixed_point(val, num_decimals, &fixed_point))
+    {
+        return json_stream_gen_add_null(p_gen, p_name);
+    }
+    return jsg_add_fixed_point(p_gen, p_name, &fixed_point);
+}
+
+bool
+json_stream_gen_add_int32_scaled(
+    json_stream_gen_t* const             p_gen,
+    const char* const                    p_name,
+    const int32_t                        raw,
+    const json_stream_gen_num_decimals_t num_decimals)
+{
+    p_gen->flag_new_data_added = true;
+    if (jsg_is_chunk_closed(p_gen))
+    {
+        return false;
+    }
+    if ((num_decimals < 0) || (num_decimals > JSON_STREAM_GEN_INT32_SCALED_MAX_NUM_DECIMALS))
     {
         return json_stream_gen_add_null(p_gen, p_name);
     }
 
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
+    const uint32_t          abs_raw     = (raw < 0) ? (0U - (uint32_t)raw) : (uint32_t)raw;
+    const uint32_t          divider     = g_jsg_pow10_u32[num_decimals];
+    const jsg_fixed_point_t fixed_point = {
+        .integral_part   = abs_raw / divider,
+        .fractional_part = abs_raw % divider,
+        .num_zeros       = 0,
+        .num_decimals    = (uint32_t)num_decimals,
+        .flag_negative   = raw < 0,
+    };
+    return jsg_add_fixed_point(p_gen, p_name, &fixed_point);
+}
+
+#define JSG_HEX_BLOCK_SIZE (64U) ///< The number of bytes converted to hex at a time.
+
+static const char g_jsg_hex_digits_upper[] = "0123456789ABCDEF";
+static const char g_jsg_hex_digits_lower[] = "0123456789abcdef";
+
+/**
+ * @brief Converts the bytes to hex digits (two digits per byte, the output is not null-terminated).
+ * @details The bytes are converted by 16 at a time with SSE2 or NEON, the rest is converted by the table.
+ */
+static void
+jsg_bytes_to_hex(const uint8_t* const p_buf, const size_t len, const bool flag_lowercase, char* const p_hex_digits)
+{
+    size_t idx = 0;
+#if defined(JSG_SIMD_AVX2) || defined(JSG_SIMD_SSE2)
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i nine_x16    = _mm_set1_epi8(9);
+    const __m128i zero_x16    = _mm_set1_epi8('0');
+    const __m128i letter_x16  = _mm_set1_epi8((char)(flag_lowercase ? ('a' - '0' - 10) : ('A' - '0' - 10)));
+    while ((len - idx) >= sizeof(__m128i))
+    {
+        const __m128i bytes   = _mm_loadu_si128((const __m128i*)(const void*)&p_buf[idx]);
+        const __m128i hi      = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+        const __m128i lo      = _mm_and_si128(bytes, nibble_mask);
+        const __m128i hi_char = _mm_add_epi8(
+            _mm_add_epi8(hi, zero_x16),
+            _mm_and_si128(_mm_cmpgt_epi8(hi, nine_x16), letter_x16));
+        const __m128i lo_char = _mm_add_epi8(
+            _mm_add_epi8(lo, zero_x16),
+            _mm_and_si128(_mm_cmpgt_epi8(lo, nine_x16), letter_x16));
+        char* const   p_dst   = &p_hex_digits[idx * 2U];
+        _mm_storeu_si128((__m128i*)(void*)p_dst, _mm_unpacklo_epi8(hi_char, lo_char));
+        _mm_storeu_si128((__m128i*)(void*)&p_dst[sizeof(__m128i)], _mm_unpackhi_epi8(hi_char, lo_char));
+        idx += sizeof(__m128i);
+    }
+#elif defined(JSG_SIMD_NEON)
+    const uint8x16_t digits = vld1q_u8(
+        (const uint8_t*)(flag_lowercase ? g_jsg_hex_digits_lower : g_jsg_hex_digits_upper));
+    while ((len - idx) >= sizeof(uint8x16_t))
+    {
+        const uint8x16_t bytes = vld1q_u8(&p_buf[idx]);
+        uint8x16x2_t     hex;
+        hex.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(bytes, 4));
+        hex.val[1] = vqtbl1q_u8(digits, vandq_u8(bytes, vdupq_n_u8(0x0F)));
+        vst2q_u8((uint8_t*)&p_hex_digits[idx * 2U], hex); // Interleaves the high and low digits.
+        idx += sizeof(uint8x16_t);
+    }
+#endif
+    const char* const p_digits = flag_lowercase ? g_jsg_hex_digits_lower : g_jsg_hex_digits_upper;
+    for (; idx < len; ++idx)
+    {
+        p_hex_digits[idx * 2U]        = p_digits[p_buf[idx] >> 4U];
+        p_hex_digits[(idx * 2U) + 1U] = p_digits[p_buf[idx] & 0x0FU];
+    }
+}
+
+static bool
+jsg_print_hex_buf(
+    json_stream_gen_t* const p_gen,
+    const size_t             saved_chunk_buf_idx,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len)
+{
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%s", double_str.buffer))
+    if (!jsg_append_char(p_gen, saved_chunk_buf_idx, '"'))
     {
         return false;
     }
-    p_gen->is_first_item = false;
-    return true;
+    for (size_t offset = 0; offset < buf_len; offset += JSG_HEX_BLOCK_SIZE)
+    {
+        const size_t len = ((buf_len - offset) < JSG_HEX_BLOCK_SIZE) ? (buf_len - offset) : JSG_HEX_BLOCK_SIZE;
+        char         hex_digits[JSG_HEX_BLOCK_SIZE * 2U];
+        jsg_bytes_to_hex(&p_buf[offset], len, p_gen->cfg.flag_hex_lowercase, hex_digits);
+        if (!jsg_append(p_gen, saved_chunk_buf_idx, hex_digits, len * 2U))
+        {
+            return false;
+        }
+    }
+    return jsg_append_char(p_gen, saved_chunk_buf_idx, '"');
 }
 
 bool
@@ -1155,26 +2630,763 @@ json_stream_gen_add_hex_buf(
     const uint8_t* const     p_buf,
     size_t                   buf_len)
 {
-    const size_t saved_chunk_buf_idx = p_gen->chunk_buf_idx;
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!p_gen->is_value_split)
+    {
+        if (jsg_print_hex_buf(p_gen, saved_chunk_buf_idx, p_name, p_buf, buf_len))
+        {
+            p_gen->is_first_item = false;
+            return true;
+        }
+        if (!jsg_start_split_value(p_gen, saved_chunk_buf_idx, p_name))
+        {
+            return false;
+        }
+    }
+    // Every part of the split value is committed to the chunk as soon as it is printed.
+    // The value can be continued from any byte, so the part is limited by the space left in the chunk.
+    while (p_gen->value_offset < buf_len)
+    {
+        const size_t remaining_len = (size_t)p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx - 1;
+        size_t       len           = buf_len - p_gen->value_offset;
+        if (len > (remaining_len / 2U))
+        {
+            // If there is room for only one digit, the byte is still tried, since it can be carried over.
+            len = (remaining_len < 2U) ? 1U : (remaining_len / 2U);
+        }
+        if (len > JSG_HEX_BLOCK_SIZE)
+        {
+            len = JSG_HEX_BLOCK_SIZE;
+        }
+        char hex_digits[JSG_HEX_BLOCK_SIZE * 2U];
+        jsg_bytes_to_hex(&p_buf[p_gen->value_offset], len, p_gen->cfg.flag_hex_lowercase, hex_digits);
+        if (!jsg_put_split_value_part(p_gen, hex_digits, len * 2U))
+        {
+            return false;
+        }
+        p_gen->value_offset += len;
+    }
+    return jsg_finish_split_value(p_gen);
+}
+
+#define JSG_BASE64_GROUP_SIZE       (3U)  ///< The number of bytes encoded by 4 characters.
+#define JSG_BASE64_GROUP_LEN        (4U)  ///< The number of characters which encode 3 bytes.
+#define JSG_BASE64_BLOCK_NUM_GROUPS (16U) ///< The number of groups encoded at a time.
+
+static const char g_jsg_base64_alphabet[]    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char g_jsg_base64url_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/**
+ * @brief Encodes the complete 3-byte groups in Base64.
+ * @details With SSSE3, 12 bytes are encoded at a time (the bytes are spread to 6-bit fields by a shuffle and
+ * multiplications, and the fields are mapped to the alphabet by a shuffle of the offsets), with NEON (AArch64)
+ * 48 bytes are encoded at a time by a lookup in the 64-byte table, the rest is encoded by the table.
+ * @param p_buf is a pointer to the bytes to encode.
+ * @param num_groups is the number of 3-byte groups.
+ * @param flag_url is true to use the URL and filename safe alphabet.
+ * @param p_out is the output buffer for num_groups * 4 characters (it's not null-terminated).
+ */
+static void
+jsg_base64_encode_groups(const uint8_t* const p_buf, const size_t num_groups, const bool flag_url, char* const p_out)
+{
+    const char* const p_alphabet = flag_url ? g_jsg_base64url_alphabet : g_jsg_base64_alphabet;
+    size_t            group_idx  = 0;
+#if defined(__SSSE3__) && (defined(JSG_SIMD_AVX2) || defined(JSG_SIMD_SSE2))
+    // 16 bytes are loaded, but only 12 of them (4 groups) are encoded, so the loop runs while 6 groups are left.
+    const __m128i shuffle   = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i shift_lut = _mm_setr_epi8(
+        (char)('a' - 26),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)('0' - 52),
+        (char)(p_alphabet[62] - 62),
+        (char)(p_alphabet[63] - 63),
+        'A',
+        0,
+        0);
+    while ((num_groups - group_idx) >= 6U)
+    {
+        const __m128i bytes   = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(const void*)&p_buf[group_idx * JSG_BASE64_GROUP_SIZE]),
+            shuffle);
+        const __m128i t0      = _mm_and_si128(bytes, _mm_set1_epi32(0x0FC0FC00));
+        const __m128i t1      = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2      = _mm_and_si128(bytes, _mm_set1_epi32(0x003F03F0));
+        const __m128i t3      = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(t1, t3);
+        const __m128i less_26 = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        const __m128i reduced = _mm_or_si128(
+            _mm_subs_epu8(indices, _mm_set1_epi8(51)),
+            _mm_and_si128(less_26, _mm_set1_epi8(13)));
+        const __m128i chars   = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, reduced), indices);
+        _mm_storeu_si128((__m128i*)(void*)&p_out[group_idx * JSG_BASE64_GROUP_LEN], chars);
+        group_idx += 4U;
+    }
+#elif defined(JSG_SIMD_NEON)
+    const uint8x16x4_t lut         = vld1q_u8_x4((const uint8_t*)p_alphabet);
+    const uint8x16_t   mask_6_bits = vdupq_n_u8(0x3F);
+    while ((num_groups - group_idx) >= 16U)
+    {
+        const uint8x16x3_t bytes = vld3q_u8(&p_buf[group_idx * JSG_BASE64_GROUP_SIZE]);
+        uint8x16x4_t       indices;
+        indices.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        indices.val[1] = vandq_u8(vorrq_u8(vshrq_n_u8(bytes.val[1], 4), vshlq_n_u8(bytes.val[0], 4)), mask_6_bits);
+        indices.val[2] = vandq_u8(vorrq_u8(vshrq_n_u8(bytes.val[2], 6), vshlq_n_u8(bytes.val[1], 2)), mask_6_bits);
+        indices.val[3] = vandq_u8(bytes.val[2], mask_6_bits);
+        uint8x16x4_t chars;
+        chars.val[0] = vqtbl4q_u8(lut, indices.val[0]);
+        chars.val[1] = vqtbl4q_u8(lut, indices.val[1]);
+        chars.val[2] = vqtbl4q_u8(lut, indices.val[2]);
+        chars.val[3] = vqtbl4q_u8(lut, indices.val[3]);
+        vst4q_u8((uint8_t*)&p_out[group_idx * JSG_BASE64_GROUP_LEN], chars);
+        group_idx += 16U;
+    }
+#endif
+    for (; group_idx < num_groups; ++group_idx)
+    {
+        const uint8_t* const p_src = &p_buf[group_idx * JSG_BASE64_GROUP_SIZE];
+        char* const          p_dst = &p_out[group_idx * JSG_BASE64_GROUP_LEN];
+        const uint32_t       val   = ((uint32_t)p_src[0] << 16U) | ((uint32_t)p_src[1] << 8U) | p_src[2];
+        p_dst[0]                   = p_alphabet[(val >> 18U) & 0x3FU];
+        p_dst[1]                   = p_alphabet[(val >> 12U) & 0x3FU];
+        p_dst[2]                   = p_alphabet[(val >> 6U) & 0x3FU];
+        p_dst[3]                   = p_alphabet[val & 0x3FU];
+    }
+}
+
+/**
+ * @brief Encodes the last incomplete group of 1 or 2 bytes.
+ * @return Returns the number of characters: 4 with padding or 2 or 3 without padding (Base64url).
+ */
+static size_t
+jsg_base64_encode_tail(const uint8_t* const p_buf, const size_t len, const bool flag_url, char* const p_out)
+{
+    const char* const p_alphabet = flag_url ? g_jsg_base64url_alphabet : g_jsg_base64_alphabet;
+    const uint32_t    val        = ((uint32_t)p_buf[0] << 16U) | ((len > 1U) ? ((uint32_t)p_buf[1] << 8U) : 0U);
+    p_out[0]                     = p_alphabet[(val >> 18U) & 0x3FU];
+    p_out[1]                     = p_alphabet[(val >> 12U) & 0x3FU];
+    p_out[2]                     = (len > 1U) ? p_alphabet[(val >> 6U) & 0x3FU] : '=';
+    p_out[3]                     = '=';
+    if (flag_url)
+    {
+        return len + 1U;
+    }
+    return JSG_BASE64_GROUP_LEN;
+}
+
+static bool
+jsg_print_base64(
+    json_stream_gen_t* const p_gen,
+    const size_t             saved_chunk_buf_idx,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len,
+    const bool               flag_url)
+{
     if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
     {
         return false;
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "\""))
+    if (!jsg_append_char(p_gen, saved_chunk_buf_idx, '"'))
     {
         return false;
     }
-    for (size_t i = 0; i < buf_len; ++i)
+    const size_t num_groups = buf_len / JSG_BASE64_GROUP_SIZE;
+    for (size_t group_idx = 0; group_idx < num_groups; group_idx += JSG_BASE64_BLOCK_NUM_GROUPS)
+    {
+        const size_t num_block_groups = ((num_groups - group_idx) < JSG_BASE64_BLOCK_NUM_GROUPS)
+                                            ? (num_groups - group_idx)
+                                            : JSG_BASE64_BLOCK_NUM_GROUPS;
+        char         chars[JSG_BASE64_BLOCK_NUM_GROUPS * JSG_BASE64_GROUP_LEN];
+        jsg_base64_encode_groups(&p_buf[group_idx * JSG_BASE64_GROUP_SIZE], num_block_groups, flag_url, chars);
+        if (!jsg_append(p_gen, saved_chunk_buf_idx, chars, num_block_groups * JSG_BASE64_GROUP_LEN))
+        {
+            return false;
+        }
+    }
+    const size_t tail_len = buf_len - (num_groups * JSG_BASE64_GROUP_SIZE);
+    if (0 != tail_len)
+    {
+        char         chars[JSG_BASE64_GROUP_LEN];
+        const size_t len = jsg_base64_encode_tail(&p_buf[buf_len - tail_len], tail_len, flag_url, chars);
+        if (!jsg_append(p_gen, saved_chunk_buf_idx, chars, len))
+        {
+            return false;
+        }
+    }
+    return jsg_append_char(p_gen, saved_chunk_buf_idx, '"');
+}
+
+static bool
+jsg_add_base64(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len,
+    const bool               flag_url)
+{
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!p_gen->is_value_split)
     {
-        if (!jsg_printf(p_gen, saved_chunk_buf_idx, "%02X", p_buf[i]))
+        if (jsg_print_base64(p_gen, saved_chunk_buf_idx, p_name, p_buf, buf_len, flag_url))
+        {
+            p_gen->is_first_item = false;
+            return true;
+        }
+        if (!jsg_start_split_value(p_gen, saved_chunk_buf_idx, p_name))
+        {
+            return false;
+        }
+    }
+    // Every part of the split value is committed to the chunk as soon as it is printed.
+    // The value is continued from the beginning of a 3-byte group, which is encoded by 4 characters.
+    while (p_gen->value_offset < buf_len)
+    {
+        const size_t rest_len = buf_len - p_gen->value_offset;
+        char         chars[JSG_BASE64_BLOCK_NUM_GROUPS * JSG_BASE64_GROUP_LEN];
+        size_t       num_bytes = rest_len;
+        size_t       num_chars = 0;
+        if (rest_len < JSG_BASE64_GROUP_SIZE)
+        {
+            num_chars = jsg_base64_encode_tail(&p_buf[p_gen->value_offset], rest_len, flag_url, chars);
+        }
+        else
+        {
+            const size_t remaining_len = (size_t)p_gen->cfg.max_chunk_size - p_gen->chunk_buf_idx - 1;
+            size_t       num_groups    = rest_len / JSG_BASE64_GROUP_SIZE;
+            if (num_groups > (remaining_len / JSG_BASE64_GROUP_LEN))
+            {
+                // If there is no room for a whole group, it is still tried, since it can be carried over.
+                num_groups = (remaining_len < JSG_BASE64_GROUP_LEN) ? 1U : (remaining_len / JSG_BASE64_GROUP_LEN);
+            }
+            if (num_groups > JSG_BASE64_BLOCK_NUM_GROUPS)
+            {
+                num_groups = JSG_BASE64_BLOCK_NUM_GROUPS;
+            }
+            jsg_base64_encode_groups(&p_buf[p_gen->value_offset], num_groups, flag_url, chars);
+            num_bytes = num_groups * JSG_BASE64_GROUP_SIZE;
+            num_chars = num_groups * JSG_BASE64_GROUP_LEN;
+        }
+        if (!jsg_put_split_value_part(p_gen, chars, num_chars))
         {
             return false;
         }
+        p_gen->value_offset += num_bytes;
+    }
+    return jsg_finish_split_value(p_gen);
+}
+
+bool
+json_stream_gen_add_base64(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len)
+{
+    return jsg_add_base64(p_gen, p_name, p_buf, buf_len, false);
+}
+
+bool
+json_stream_gen_add_base64url(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint8_t* const     p_buf,
+    const size_t             buf_len)
+{
+    return jsg_add_base64(p_gen, p_name, p_buf, buf_len, true);
+}
+
+#define JSG_TIMESTAMP_MIN_EPOCH_MS (-62167219200000LL) ///< 0000-01-01T00:00:00.000Z
+#define JSG_TIMESTAMP_MAX_EPOCH_MS (253402300799999LL) ///< 9999-12-31T23:59:59.999Z
+#define JSG_TIMESTAMP_ISO8601_LEN  (26U)               ///< "YYYY-MM-DDThh:mm:ss.sssZ" with the quotes.
+
+#define JSG_MS_PER_SEC          (1000U)
+#define JSG_MS_PER_DAY          (86400000U)
+#define JSG_SEC_PER_HOUR        (3600U)
+#define JSG_SEC_PER_MIN         (60U)
+#define JSG_DAYS_PER_ERA        (146097U) ///< The number of days in 400 years.
+#define JSG_YEARS_PER_ERA       (400U)
+#define JSG_DAYS_JAN_FEB_YEAR_0 (60U) ///< The year 0 is a leap year.
+
+/**
+ * @brief Copies the two decimal digits of the value (0..99).
+ */
+static void
+jsg_put_2_digits(char* const p_dst, const uint32_t val)
+{
+    memcpy(p_dst, &g_jsg_digit_pairs[val * 2U], 2);
+}
+
+/**
+ * @brief Prints the UTC time as "YYYY-MM-DDThh:mm:ss.sssZ" with the quotes.
+ * @details The date is calculated with the civil_from_days algorithm by Howard Hinnant, which uses only integer
+ * arithmetic without loops or tables. The years are counted from 0000-03-01, so the leap day is the last day
+ * of the year. The days are shifted by one 400-year era to keep all the values non-negative.
+ * @param epoch_ms is the number of milliseconds since 1970-01-01T00:00:00Z,
+ * it must be in the range JSG_TIMESTAMP_MIN_EPOCH_MS..JSG_TIMESTAMP_MAX_EPOCH_MS.
+ */
+static void
+jsg_epoch_ms_to_iso8601(const int64_t epoch_ms, char* const p_buf)
+{
+    const uint64_t ms_since_year_0 = (uint64_t)(epoch_ms - JSG_TIMESTAMP_MIN_EPOCH_MS);
+    const uint32_t ms_of_day       = (uint32_t)(ms_since_year_0 % JSG_MS_PER_DAY);
+
+    const uint32_t days  = (uint32_t)(ms_since_year_0 / JSG_MS_PER_DAY) + JSG_DAYS_PER_ERA - JSG_DAYS_JAN_FEB_YEAR_0;
+    const uint32_t era   = days / JSG_DAYS_PER_ERA;
+    const uint32_t doe   = days - (era * JSG_DAYS_PER_ERA);                                 // [0, 146096]
+    const uint32_t yoe   = (doe - (doe / 1460U) + (doe / 36524U) - (doe / 146096U)) / 365U; // [0, 399]
+    const uint32_t doy   = doe - ((365U * yoe) + (yoe / 4U) - (yoe / 100U));                // [0, 365]
+    const uint32_t mp    = ((5U * doy) + 2U) / 153U;                                        // [0, 11], March is 0
+    const uint32_t day   = (doy - (((153U * mp) + 2U) / 5U)) + 1U;
+    const uint32_t month = (mp < 10U) ? (mp + 3U) : (mp - 9U);
+    const uint32_t year  = ((yoe + (era * JSG_YEARS_PER_ERA)) - JSG_YEARS_PER_ERA) + ((month <= 2U) ? 1U : 0U);
+
+    const uint32_t sec_of_day = ms_of_day / JSG_MS_PER_SEC;
+    const uint32_t msec       = ms_of_day % JSG_MS_PER_SEC;
+
+    p_buf[0] = '"';
+    jsg_put_2_digits(&p_buf[1], year / JSON_STREAM_GEN_CONST_U32_100);
+    jsg_put_2_digits(&p_buf[3], year % JSON_STREAM_GEN_CONST_U32_100);
+    p_buf[5] = '-';
+    jsg_put_2_digits(&p_buf[6], month);
+    p_buf[8] = '-';
+    jsg_put_2_digits(&p_buf[9], day);
+    p_buf[11] = 'T';
+    jsg_put_2_digits(&p_buf[12], sec_of_day / JSG_SEC_PER_HOUR);
+    p_buf[14] = ':';
+    jsg_put_2_digits(&p_buf[15], (sec_of_day / JSG_SEC_PER_MIN) % JSG_SEC_PER_MIN);
+    p_buf[17] = ':';
+    jsg_put_2_digits(&p_buf[18], sec_of_day % JSG_SEC_PER_MIN);
+    p_buf[20] = '.';
+    p_buf[21] = (char)('0' + (msec / JSON_STREAM_GEN_CONST_U32_100));
+    jsg_put_2_digits(&p_buf[22], msec % JSON_STREAM_GEN_CONST_U32_100);
+    p_buf[24] = 'Z';
+    p_buf[25] = '"';
+}
+
+bool
+json_stream_gen_add_timestamp_iso8601(json_stream_gen_t* const p_gen, const char* const p_name, const int64_t epoch_ms)
+{
+    if ((epoch_ms < JSG_TIMESTAMP_MIN_EPOCH_MS) || (epoch_ms > JSG_TIMESTAMP_MAX_EPOCH_MS))
+    {
+        return json_stream_gen_add_null(p_gen, p_name);
     }
-    if (!jsg_printf(p_gen, saved_chunk_buf_idx, "\""))
+    const size_t saved_chunk_buf_idx = jsg_begin_item(p_gen);
+    if (!jsg_print_prefix(p_gen, saved_chunk_buf_idx, p_name))
+    {
+        return false;
+    }
+    char timestamp_str[JSG_TIMESTAMP_ISO8601_LEN];
+    jsg_epoch_ms_to_iso8601(epoch_ms, timestamp_str);
+    if (!jsg_append(p_gen, saved_chunk_buf_idx, timestamp_str, sizeof(timestamp_str)))
     {
         return false;
     }
     p_gen->is_first_item = false;
     return true;
 }
+
+bool
+json_stream_gen_add_timestamp_epoch_ms(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const int64_t            epoch_ms)
+{
+    return json_stream_gen_add_int64(p_gen, p_name, epoch_ms);
+}
+
+static bool
+jsg_start_array_with_cursor(json_stream_gen_t* const p_gen, const char* const p_name)
+{
+    if (!jsg_start_obj_or_arr(p_gen, p_name, '['))
+    {
+        return false;
+    }
+    p_gen->is_array_started = true;
+    p_gen->array_elem_idx   = 0;
+    return true;
+}
+
+static bool
+jsg_end_array_with_cursor(json_stream_gen_t* const p_gen)
+{
+    if (!jsg_end_obj_or_array(p_gen, ']'))
+    {
+        return false;
+    }
+    p_gen->is_array_started = false;
+    p_gen->array_elem_idx   = 0;
+    return true;
+}
+
+typedef bool (*jsg_add_array_elem_t)(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx);
+
+#define JSG_INT_BATCH_SIZE       (4U)          ///< The number of 32-bit integers printed at a time.
+#define JSG_INT_BATCH_NUM_DIGITS (8U)          ///< The number of digits printed by the SIMD kernels for every value.
+#define JSG_INT_BATCH_MAX_LEN    (11U)         ///< The sign and 10 digits.
+#define JSG_DIV_10000_MUL        (0xD1B71759U) ///< (x * JSG_DIV_10000_MUL) >> 45 == x / 10000 for any 32-bit x.
+#define JSG_DIV_10000_SHIFT      (45U)
+#define JSG_DIV_100_MUL          (5243U)       ///< (x * JSG_DIV_100_MUL) >> 19 == x / 100 for x < 10000.
+#define JSG_DIV_100_SHIFT        (19U)
+#define JSG_DIV_10_MUL           (103U)        ///< (x * JSG_DIV_10_MUL) >> 10 == x / 10 for x < 100.
+#define JSG_DIV_10_SHIFT         (10U)
+
+#if defined(JSG_SIMD_AVX2) || defined(JSG_SIMD_SSE2) || defined(JSG_SIMD_NEON)
+/**
+ * @brief Prints 4 integers below 10^8 as 8 decimal digits each (with the leading zeros).
+ * @details All the values are converted in parallel: they are split into two 4-digit groups, the 8 groups are split
+ * into two 2-digit halves in 16-bit lanes, and the halves are split into the digits.
+ * The divisions are replaced by multiplications by the reciprocals.
+ */
+static void
+jsg_u32x4_to_digits(const uint32_t* const p_vals, char* const p_digits)
+{
+#if defined(JSG_SIMD_AVX2) || defined(JSG_SIMD_SSE2)
+    const __m128i vals      = _mm_loadu_si128((const __m128i*)(const void*)p_vals);
+    const __m128i div_10000 = _mm_set1_epi32((int32_t)JSG_DIV_10000_MUL);
+    const __m128i hi_even   = _mm_srli_epi64(_mm_mul_epu32(vals, div_10000), JSG_DIV_10000_SHIFT);
+    const __m128i hi_odd    = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(vals, 32), div_10000), JSG_DIV_10000_SHIFT);
+    const __m128i hi        = _mm_or_si128(hi_even, _mm_slli_epi64(hi_odd, 32));
+    // The upper 16 bits of hi are zero, so madd gives hi * 10000 in 32-bit lanes.
+    const __m128i lo      = _mm_sub_epi32(vals, _mm_madd_epi16(hi, _mm_set1_epi32(10000)));
+    const __m128i groups  = _mm_packs_epi32(_mm_unpacklo_epi32(hi, lo), _mm_unpackhi_epi32(hi, lo));
+    const __m128i pair_hi = _mm_srli_epi16(
+        _mm_mulhi_epu16(groups, _mm_set1_epi16(JSG_DIV_100_MUL)),
+        JSG_DIV_100_SHIFT - 16U);
+    const __m128i pair_lo  = _mm_sub_epi16(groups, _mm_mullo_epi16(pair_hi, _mm_set1_epi16(100)));
+    const __m128i div_10   = _mm_set1_epi16(JSG_DIV_10_MUL);
+    const __m128i tens_hi  = _mm_srli_epi16(_mm_mullo_epi16(pair_hi, div_10), JSG_DIV_10_SHIFT);
+    const __m128i tens_lo  = _mm_srli_epi16(_mm_mullo_epi16(pair_lo, div_10), JSG_DIV_10_SHIFT);
+    const __m128i ones_hi  = _mm_sub_epi16(pair_hi, _mm_mullo_epi16(tens_hi, _mm_set1_epi16(10)));
+    const __m128i ones_lo  = _mm_sub_epi16(pair_lo, _mm_mullo_epi16(tens_lo, _mm_set1_epi16(10)));
+    const __m128i chars_hi = _mm_or_si128(tens_hi, _mm_slli_epi16(ones_hi, 8));
+    const __m128i chars_lo = _mm_or_si128(tens_lo, _mm_slli_epi16(ones_lo, 8));
+    const __m128i zeros    = _mm_set1_epi8('0');
+    _mm_storeu_si128((__m128i*)(void*)p_digits, _mm_add_epi8(_mm_unpacklo_epi16(chars_hi, chars_lo), zeros));
+    _mm_storeu_si128(
+        (__m128i*)(void*)&p_digits[sizeof(__m128i)],
+        _mm_add_epi8(_mm_unpackhi_epi16(chars_hi, chars_lo), zeros));
+#else
+    const uint32x4_t vals      = vld1q_u32(p_vals);
+    const uint32x4_t div_10000 = vdupq_n_u32(JSG_DIV_10000_MUL);
+    const uint32x4_t hi        = vshrq_n_u32(
+        vcombine_u32(
+            vshrn_n_u64(vmull_u32(vget_low_u32(vals), vget_low_u32(div_10000)), 32),
+            vshrn_n_u64(vmull_high_u32(vals, div_10000), 32)),
+        JSG_DIV_10000_SHIFT - 32U);
+    const uint32x4_t lo      = vmlsq_n_u32(vals, hi, 10000U);
+    const uint16x8_t groups  = vcombine_u16(vmovn_u32(vzip1q_u32(hi, lo)), vmovn_u32(vzip2q_u32(hi, lo)));
+    const uint16x8_t pair_hi = vshrq_n_u16(
+        vcombine_u16(
+            vshrn_n_u32(vmull_n_u16(vget_low_u16(groups), JSG_DIV_100_MUL), 16),
+            vshrn_n_u32(vmull_high_n_u16(groups, JSG_DIV_100_MUL), 16)),
+        JSG_DIV_100_SHIFT - 16U);
+    const uint16x8_t pair_lo = vmlsq_n_u16(groups, pair_hi, 100U);
+    const uint16x8_t tens_hi = vshrq_n_u16(vmulq_n_u16(pair_hi, JSG_DIV_10_MUL), JSG_DIV_10_SHIFT);
+    const uint16x8_t tens_lo = vshrq_n_u16(vmulq_n_u16(pair_lo, JSG_DIV_10_MUL), JSG_DIV_10_SHIFT);
+    // The tens are in the low bytes and the ones are inserted into the high bytes.
+    const uint16x8_t chars_hi = vsliq_n_u16(tens_hi, vmlsq_n_u16(pair_hi, tens_hi, 10U), 8);
+    const uint16x8_t chars_lo = vsliq_n_u16(tens_lo, vmlsq_n_u16(pair_lo, tens_lo, 10U), 8);
+    const uint8x16_t zeros    = vdupq_n_u8('0');
+    vst1q_u8((uint8_t*)p_digits, vaddq_u8(vreinterpretq_u8_u16(vzip1q_u16(chars_hi, chars_lo)), zeros));
+    vst1q_u8(
+        (uint8_t*)&p_digits[sizeof(uint8x16_t)],
+        vaddq_u8(vreinterpretq_u8_u16(vzip2q_u16(chars_hi, chars_lo)), zeros));
+#endif
+}
+#endif
+
+/**
+ * @brief Adds JSG_INT_BATCH_SIZE elements of an int32 or uint32 array at once.
+ * @details The elements are printed with their separators directly into the chunk buffer.
+ * The batch is added only if it certainly fits into the chunk, otherwise the elements are added one by one,
+ * so the chunks are the same as without batching.
+ * @return Returns false if the batch was not added.
+ */
+static bool
+jsg_add_array_batch_32(
+    json_stream_gen_t* const p_gen,
+    const void* const        p_arr,
+    const size_t             idx,
+    const bool               flag_signed)
+{
+    const size_t indent  = (size_t)p_gen->cur_nesting_level * p_gen->indent_step;
+    const size_t sep_len = 1U + p_gen->eol_len + indent;
+    if ((JSG_SPILL_STATE_NONE != p_gen->spill_state) || p_gen->is_counting_only
+        || ((p_gen->chunk_buf_idx + (JSG_INT_BATCH_SIZE * (sep_len + JSG_INT_BATCH_MAX_LEN)))
+            >= (size_t)p_gen->cfg.max_chunk_size))
+    {
+        return false;
+    }
+    uint32_t abs_vals[JSG_INT_BATCH_SIZE];
+    bool     is_negative[JSG_INT_BATCH_SIZE];
+    uint32_t max_abs_val = 0;
+    for (uint32_t i = 0; i < JSG_INT_BATCH_SIZE; ++i)
+    {
+        if (flag_signed)
+        {
+            const int32_t val = ((const int32_t*)p_arr)[idx + i];
+            is_negative[i]    = val < 0;
+            abs_vals[i]       = is_negative[i] ? (0U - (uint32_t)val) : (uint32_t)val;
+        }
+        else
+        {
+            is_negative[i] = false;
+            abs_vals[i]    = ((const uint32_t*)p_arr)[idx + i];
+        }
+        max_abs_val = (abs_vals[i] > max_abs_val) ? abs_vals[i] : max_abs_val;
+    }
+#if defined(JSG_SIMD_AVX2) || defined(JSG_SIMD_SSE2) || defined(JSG_SIMD_NEON)
+    char       digits[JSG_INT_BATCH_SIZE * JSG_INT_BATCH_NUM_DIGITS];
+    const bool flag_simd = max_abs_val < g_jsg_pow10_u32[JSG_INT_BATCH_NUM_DIGITS];
+    if (flag_simd)
+    {
+        jsg_u32x4_to_digits(abs_vals, digits);
+    }
+#endif
+    char* p_dst = &p_gen->p_chunk_buf[p_gen->chunk_buf_idx];
+    for (uint32_t i = 0; i < JSG_INT_BATCH_SIZE; ++i)
+    {
+        if (p_gen->is_first_item && (0 == i))
+        {
+            memcpy(p_dst, &p_gen->p_separators[1], sep_len - 1U);
+            p_dst += sep_len - 1U;
+        }
+        else
+        {
+            memcpy(p_dst, p_gen->p_separators, sep_len);
+            p_dst += sep_len;
+        }
+        if (is_negative[i])
+        {
+            *p_dst++ = '-';
+        }
+#if defined(JSG_SIMD_AVX2) || defined(JSG_SIMD_SSE2) || defined(JSG_SIMD_NEON)
+        if (flag_simd)
+        {
+            uint32_t num_digits = 1;
+            while ((num_digits < JSG_INT_BATCH_NUM_DIGITS) && (abs_vals[i] >= g_jsg_pow10_u32[num_digits]))
+            {
+                num_digits += 1;
+            }
+            memcpy(p_dst, &digits[((i + 1U) * JSG_INT_BATCH_NUM_DIGITS) - num_digits], num_digits);
+            p_dst += num_digits;
+            continue;
+        }
+#endif
+        jsg_int_str_buf_t int_str = { 0 };
+        char* const       p_end   = &int_str.buffer[sizeof(int_str.buffer)];
+        const char* const p_str   = jsg_u32_to_str_backward(abs_vals[i], p_end);
+        memcpy(p_dst, p_str, (size_t)(p_end - p_str));
+        p_dst += p_end - p_str;
+    }
+    p_gen->chunk_buf_idx                     = (size_t)(p_dst - p_gen->p_chunk_buf);
+    p_gen->p_chunk_buf[p_gen->chunk_buf_idx] = '\0';
+    p_gen->flag_new_data_added               = true;
+    p_gen->is_first_item                     = false;
+    return true;
+}
+
+static bool
+jsg_add_array_batch_int32(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return jsg_add_array_batch_32(p_gen, p_arr, idx, true);
+}
+
+static bool
+jsg_add_array_batch_uint32(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return jsg_add_array_batch_32(p_gen, p_arr, idx, false);
+}
+
+/**
+ * @brief Adds the array element by element, p_add_batch (if not NULL) is tried first to add JSG_INT_BATCH_SIZE
+ * elements at once.
+ */
+static bool
+jsg_add_array(
+    json_stream_gen_t* const   p_gen,
+    const char* const          p_name,
+    const void* const          p_arr,
+    const size_t               count,
+    const jsg_add_array_elem_t p_add_elem,
+    const jsg_add_array_elem_t p_add_batch)
+{
+    if (!p_gen->is_array_started)
+    {
+        if (NULL == p_arr)
+        {
+            return json_stream_gen_add_null(p_gen, p_name);
+        }
+        if (!jsg_start_array_with_cursor(p_gen, p_name))
+        {
+            return false;
+        }
+    }
+    while (p_gen->array_elem_idx < count)
+    {
+        if ((NULL != p_add_batch) && ((count - p_gen->array_elem_idx) >= JSG_INT_BATCH_SIZE)
+            && p_add_batch(p_gen, p_arr, p_gen->array_elem_idx))
+        {
+            p_gen->array_elem_idx += JSG_INT_BATCH_SIZE;
+            continue;
+        }
+        if (!p_add_elem(p_gen, p_arr, p_gen->array_elem_idx))
+        {
+            return false;
+        }
+        p_gen->array_elem_idx += 1;
+    }
+    return jsg_end_array_with_cursor(p_gen);
+}
+
+static bool
+jsg_add_array_elem_int32(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_int32(p_gen, NULL, ((const int32_t*)p_arr)[idx]);
+}
+
+static bool
+jsg_add_array_elem_uint32(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_uint32(p_gen, NULL, ((const uint32_t*)p_arr)[idx]);
+}
+
+static bool
+jsg_add_array_elem_int64(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_int64(p_gen, NULL, ((const int64_t*)p_arr)[idx]);
+}
+
+static bool
+jsg_add_array_elem_uint64(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_uint64(p_gen, NULL, ((const uint64_t*)p_arr)[idx]);
+}
+
+static bool
+jsg_add_array_elem_float(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_float(p_gen, NULL, ((const float*)p_arr)[idx], -1);
+}
+
+static bool
+jsg_add_array_elem_double(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_double(p_gen, NULL, ((const double*)p_arr)[idx], -1);
+}
+
+static bool
+jsg_add_array_elem_bool(json_stream_gen_t* const p_gen, const void* const p_arr, const size_t idx)
+{
+    return json_stream_gen_add_bool(p_gen, NULL, ((const bool*)p_arr)[idx]);
+}
+
+bool
+json_stream_gen_add_int32_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const int32_t* const     p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_int32, &jsg_add_array_batch_int32);
+}
+
+bool
+json_stream_gen_add_uint32_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint32_t* const    p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_uint32, &jsg_add_array_batch_uint32);
+}
+
+bool
+json_stream_gen_add_int64_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const int64_t* const     p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_int64, NULL);
+}
+
+bool
+json_stream_gen_add_uint64_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const uint64_t* const    p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_uint64, NULL);
+}
+
+bool
+json_stream_gen_add_float_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const float* const       p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_float, NULL);
+}
+
+bool
+json_stream_gen_add_double_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const double* const      p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_double, NULL);
+}
+
+bool
+json_stream_gen_add_bool_array(
+    json_stream_gen_t* const p_gen,
+    const char* const        p_name,
+    const bool* const        p_arr,
+    const size_t             count)
+{
+    return jsg_add_array(p_gen, p_name, p_arr, count, &jsg_add_array_elem_bool, NULL);
+}
+
+bool
+json_stream_gen_add_array_from_iterator(
+    json_stream_gen_t* const             p_gen,
+    const char* const                    p_name,
+    const json_stream_gen_cb_iter_next_t cb_next,
+    void* const                          p_iter_ctx)
+{
+    if ((!p_gen->is_array_started) && (!jsg_start_array_with_cursor(p_gen, p_name)))
+    {
+        return false;
+    }
+    while (true)
+    {
+        if (jsg_is_chunk_closed(p_gen))
+        {
+            // The element would be discarded anyway, so the callback is not called to format it.
+            return false;
+        }
+        const json_stream_gen_iter_result_t res = cb_next(p_gen, p_iter_ctx, p_gen->array_elem_idx);
+        if (JSON_STREAM_GEN_ITER_RESULT_END == res.iter_res)
+        {
+            break;
+        }
+        if (JSON_STREAM_GEN_ITER_RESULT_OVERFLOW == res.iter_res)
+        {
+            return false;
+        }
+        p_gen->array_elem_idx += 1;
+    }
+    return jsg_end_array_with_cursor(p_gen);
+}
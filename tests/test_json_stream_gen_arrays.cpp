@@ -0,0 +1,447 @@
+/**
+ * @file test_json_stream_gen_arrays.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen.h"
+#include "gtest/gtest.h"
+#include <string>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenA;
+static TestJsonStreamGenA* g_pTestClass;
+
+class TestJsonStreamGenA : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenA();
+
+    ~TestJsonStreamGenA() override;
+};
+
+TestJsonStreamGenA::TestJsonStreamGenA()
+    : Test()
+{
+}
+
+TestJsonStreamGenA::~TestJsonStreamGenA() = default;
+
+static string
+generate_json(json_stream_gen_t* const p_gen, const json_stream_gen_size_t max_chunk_size)
+{
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            return string("<error>");
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        if (strlen(p_chunk) >= (size_t)max_chunk_size)
+        {
+            return string("<chunk overflow>");
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+#define TEST_ARRAY_SIZE (20U)
+
+typedef struct generate_arrays_t
+{
+    int32_t  arr_i32[TEST_ARRAY_SIZE];
+    uint32_t arr_u32[TEST_ARRAY_SIZE];
+    int64_t  arr_i64[TEST_ARRAY_SIZE];
+    uint64_t arr_u64[TEST_ARRAY_SIZE];
+    float    arr_f[TEST_ARRAY_SIZE];
+    double   arr_d[TEST_ARRAY_SIZE];
+    bool     arr_b[TEST_ARRAY_SIZE];
+} generate_arrays_t;
+
+static void
+init_arrays(generate_arrays_t* const p_ctx)
+{
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        p_ctx->arr_i32[i] = (int32_t)(i * 1000) - 7000;
+        p_ctx->arr_u32[i] = i * 4000000U;
+        p_ctx->arr_i64[i] = (int64_t)i * -1000000000000LL;
+        p_ctx->arr_u64[i] = (uint64_t)i * 1000000000000ULL;
+        p_ctx->arr_f[i]   = (float)i * 1.25f;
+        p_ctx->arr_d[i]   = (double)i * -0.1;
+        p_ctx->arr_b[i]   = (0 == (i % 3));
+    }
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_arrays_bulk(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<const generate_arrays_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_INT32_ARRAY(p_gen, "i32", p_ctx->arr_i32, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_ADD_UINT32_ARRAY(p_gen, "u32", p_ctx->arr_u32, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_ADD_INT64_ARRAY(p_gen, "i64", p_ctx->arr_i64, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_ADD_UINT64_ARRAY(p_gen, "u64", p_ctx->arr_u64, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_ADD_FLOAT_ARRAY(p_gen, "f", p_ctx->arr_f, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_ADD_DOUBLE_ARRAY(p_gen, "d", p_ctx->arr_d, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_ADD_BOOL_ARRAY(p_gen, "b", p_ctx->arr_b, TEST_ARRAY_SIZE);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "nested");
+    JSON_STREAM_GEN_ADD_UINT32_ARRAY_TO_ARRAY(p_gen, p_ctx->arr_u32, 3);
+    JSON_STREAM_GEN_ADD_BOOL_ARRAY_TO_ARRAY(p_gen, p_ctx->arr_b, 0);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_arrays_loop(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<const generate_arrays_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "i32");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_INT32_TO_ARRAY(p_gen, p_ctx->arr_i32[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "u32");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_UINT32_TO_ARRAY(p_gen, p_ctx->arr_u32[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "i64");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_INT64_TO_ARRAY(p_gen, p_ctx->arr_i64[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "u64");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_UINT64_TO_ARRAY(p_gen, p_ctx->arr_u64[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "f");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_FLOAT_TO_ARRAY(p_gen, p_ctx->arr_f[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "d");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_DOUBLE_TO_ARRAY(p_gen, p_ctx->arr_d[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "b");
+    for (uint32_t i = 0; i < TEST_ARRAY_SIZE; ++i)
+    {
+        JSON_STREAM_GEN_ADD_BOOL_TO_ARRAY(p_gen, p_ctx->arr_b[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "nested");
+    JSON_STREAM_GEN_ADD_ARRAY_TO_ARRAY(p_gen);
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        JSON_STREAM_GEN_ADD_UINT32_TO_ARRAY(p_gen, p_ctx->arr_u32[i]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_ADD_ARRAY_TO_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_bulk_arrays(const bool flag_formatted_json)
+{
+    for (json_stream_gen_size_t max_chunk_size = 200; max_chunk_size >= 28; max_chunk_size--)
+    {
+        json_stream_gen_cfg_t cfg = {
+            .max_chunk_size      = max_chunk_size,
+            .flag_formatted_json = flag_formatted_json,
+        };
+        generate_arrays_t* p_ctx_bulk = nullptr;
+        generate_arrays_t* p_ctx_loop = nullptr;
+
+        JsonStreamGenWrapper wrapper_bulk = JsonStreamGenWrapper(
+            &cfg,
+            &cb_generate_arrays_bulk,
+            sizeof(*p_ctx_bulk),
+            (void**)&p_ctx_bulk);
+        JsonStreamGenWrapper wrapper_loop = JsonStreamGenWrapper(
+            &cfg,
+            &cb_generate_arrays_loop,
+            sizeof(*p_ctx_loop),
+            (void**)&p_ctx_loop);
+        init_arrays(p_ctx_bulk);
+        init_arrays(p_ctx_loop);
+
+        const string json_loop = generate_json(wrapper_loop.get(), max_chunk_size);
+        ASSERT_EQ('{', json_loop[0]);
+        ASSERT_EQ(json_loop, generate_json(wrapper_bulk.get(), max_chunk_size)) << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+TEST_F(TestJsonStreamGenA, test_bulk_arrays_unformatted) // NOLINT
+{
+    check_bulk_arrays(false);
+}
+
+TEST_F(TestJsonStreamGenA, test_bulk_arrays_formatted) // NOLINT
+{
+    check_bulk_arrays(true);
+}
+
+#define TEST_NUM_INT_VALUES (1024U)
+
+typedef struct generate_int_arrays_t
+{
+    int32_t  arr_i32[TEST_NUM_INT_VALUES];
+    uint32_t arr_u32[TEST_NUM_INT_VALUES];
+} generate_int_arrays_t;
+
+static json_stream_gen_callback_result_t
+cb_generate_int_arrays(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<const generate_int_arrays_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_INT32_ARRAY(p_gen, "i32", p_ctx->arr_i32, TEST_NUM_INT_VALUES);
+    JSON_STREAM_GEN_ADD_UINT32_ARRAY(p_gen, "u32", p_ctx->arr_u32, TEST_NUM_INT_VALUES);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+TEST_F(TestJsonStreamGenA, test_bulk_int_arrays_all_digit_counts) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 4096,
+    };
+    generate_int_arrays_t* p_ctx   = nullptr;
+    JsonStreamGenWrapper   wrapper = JsonStreamGenWrapper(
+        &cfg,
+        &cb_generate_int_arrays,
+        sizeof(*p_ctx),
+        (void**)&p_ctx);
+
+    // The values with any number of digits, the boundaries of the SIMD kernels (10^8) and the extremes
+    // are mixed in the same batches.
+    static const uint32_t special_vals[] = {
+        0, 1, 9, 10, 99, 100, 9999, 10000, 99999999, 100000000, 999999999, 1000000000, INT32_MAX, UINT32_MAX,
+    };
+    uint32_t rnd = 12345U;
+    for (uint32_t i = 0; i < TEST_NUM_INT_VALUES; ++i)
+    {
+        rnd = (rnd * 1103515245U) + 12345U;
+        uint32_t val = 0;
+        if (i < (sizeof(special_vals) / sizeof(special_vals[0])))
+        {
+            val = special_vals[i];
+        }
+        else
+        {
+            val = rnd >> (rnd % 32U);
+        }
+        p_ctx->arr_u32[i] = val;
+        p_ctx->arr_i32[i] = (0 != (i % 3)) ? (int32_t)val : (int32_t)(0U - val);
+    }
+    p_ctx->arr_i32[TEST_NUM_INT_VALUES - 1] = INT32_MIN;
+
+    string expected_i32("");
+    string expected_u32("");
+    for (uint32_t i = 0; i < TEST_NUM_INT_VALUES; ++i)
+    {
+        expected_i32 += ((0 != i) ? "," : "") + to_string(p_ctx->arr_i32[i]);
+        expected_u32 += ((0 != i) ? "," : "") + to_string(p_ctx->arr_u32[i]);
+    }
+    ASSERT_EQ(
+        string("{\"i32\":[") + expected_i32 + string("],\"u32\":[") + expected_u32 + string("]}"),
+        generate_json(wrapper.get(), cfg.max_chunk_size));
+}
+
+TEST_F(TestJsonStreamGenA, test_bulk_array_chunks) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 16,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            static const uint32_t arr[] = { 100, 101, 102, 103, 104, 105, 106 };
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_UINT32_ARRAY(p_gen, "arr", arr, sizeof(arr) / sizeof(arr[0]));
+            JSON_STREAM_GEN_ADD_INT32_ARRAY(p_gen, "null", (const int32_t*)nullptr, 5);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"arr\":[100,101"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",102,103,104"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",105,106]"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",\"null\":null}"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+
+    json_stream_gen_reset(p_gen);
+    ASSERT_EQ(49, json_stream_gen_calc_size(p_gen));
+}
+
+TEST_F(TestJsonStreamGenA, test_bulk_array_exceeding_nesting_level) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_nesting_level = 2,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            static const bool arr[] = { true, false };
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+            JSON_STREAM_GEN_ADD_BOOL_ARRAY_TO_ARRAY(p_gen, arr, sizeof(arr) / sizeof(arr[0]));
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"arr\":["), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_EQ(nullptr, p_chunk);
+}
+
+#define TEST_RING_BUF_SIZE (16U)
+
+typedef struct test_ring_buf_t
+{
+    uint32_t values[TEST_RING_BUF_SIZE];
+    uint32_t head_idx;
+    uint32_t num_values;
+    uint32_t cnt_iter_calls;
+} test_ring_buf_t;
+
+static json_stream_gen_iter_result_t
+cb_iter_ring_buf(json_stream_gen_t* const p_gen, void* const p_iter_ctx, const size_t idx)
+{
+    auto p_ring_buf = static_cast<test_ring_buf_t*>(p_iter_ctx);
+    p_ring_buf->cnt_iter_calls += 1;
+    if (idx >= p_ring_buf->num_values)
+    {
+        return (json_stream_gen_iter_result_t) { .iter_res = JSON_STREAM_GEN_ITER_RESULT_END };
+    }
+    const uint32_t val = p_ring_buf->values[(p_ring_buf->head_idx + idx) % TEST_RING_BUF_SIZE];
+    if (!json_stream_gen_add_uint32(p_gen, nullptr, val))
+    {
+        return (json_stream_gen_iter_result_t) { .iter_res = JSON_STREAM_GEN_ITER_RESULT_OVERFLOW };
+    }
+    return (json_stream_gen_iter_result_t) { .iter_res = JSON_STREAM_GEN_ITER_RESULT_NEXT };
+}
+
+typedef struct test_iter_ctx_t
+{
+    test_ring_buf_t ring_buf;
+    test_ring_buf_t ring_buf_empty;
+} test_iter_ctx_t;
+
+static json_stream_gen_callback_result_t
+cb_generate_array_from_iterator(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<test_iter_ctx_t*>(const_cast<void*>(p_user_ctx));
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_ARRAY_FROM_ITERATOR(p_gen, "ring", &cb_iter_ring_buf, &p_ctx->ring_buf);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "nested");
+    JSON_STREAM_GEN_ADD_ARRAY_FROM_ITERATOR_TO_ARRAY(p_gen, &cb_iter_ring_buf, &p_ctx->ring_buf_empty);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+TEST_F(TestJsonStreamGenA, test_array_from_iterator) // NOLINT
+{
+    for (json_stream_gen_size_t max_chunk_size = 100; max_chunk_size >= 16; max_chunk_size--)
+    {
+        json_stream_gen_cfg_t cfg = {
+            .max_chunk_size = max_chunk_size,
+        };
+        test_iter_ctx_t*     p_ctx   = nullptr;
+        JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+            &cfg,
+            &cb_generate_array_from_iterator,
+            sizeof(*p_ctx),
+            (void**)&p_ctx);
+        p_ctx->ring_buf.head_idx   = 10;
+        p_ctx->ring_buf.num_values = 12;
+        for (uint32_t i = 0; i < TEST_RING_BUF_SIZE; ++i)
+        {
+            p_ctx->ring_buf.values[(p_ctx->ring_buf.head_idx + i) % TEST_RING_BUF_SIZE] = 1000U + i;
+        }
+
+        string   json_str("");
+        uint32_t cnt_chunks = 0;
+        while (true)
+        {
+            const char* p_chunk = json_stream_gen_get_next_chunk(wrapper.get());
+            ASSERT_NE(nullptr, p_chunk);
+            if ('\0' == p_chunk[0])
+            {
+                break;
+            }
+            ASSERT_LT(strlen(p_chunk), (size_t)max_chunk_size);
+            json_str += string(p_chunk);
+            cnt_chunks += 1;
+        }
+        ASSERT_EQ(
+            string("{\"ring\":[1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,1010,1011],\"nested\":[[]]}"),
+            json_str);
+        // Each element is requested once, plus one retry for each chunk overflow, plus the end of the array.
+        ASSERT_LE(p_ctx->ring_buf.cnt_iter_calls, p_ctx->ring_buf.num_values + cnt_chunks + 1);
+        ASSERT_LE(p_ctx->ring_buf_empty.cnt_iter_calls, 2U);
+    }
+}
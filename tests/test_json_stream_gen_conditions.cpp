@@ -7,6 +7,7 @@
 
 #include "json_stream_gen.h"
 #include "gtest/gtest.h"
+#include <array>
 #include <string>
 #include "json_stream_gen_wrapper.h"
 
@@ -45,7 +46,8 @@ public:
 
     ~TestJsonStreamGenC() override;
 
-    string m_saved_locale;
+    string   m_saved_locale;
+    uint32_t m_cnt_localeconv {};
 };
 
 TestJsonStreamGenC::TestJsonStreamGenC()
@@ -445,6 +447,55 @@ TEST_F(TestJsonStreamGenC, test_localeconv_null) // NOLINT
     ASSERT_EQ(string(""), string(p_chunk));
 }
 
+static struct lconv*
+my_localeconv_with_cnt(void)
+{
+    g_pTestClass->m_cnt_localeconv += 1;
+    return localeconv();
+}
+
+TEST_F(TestJsonStreamGenC, test_localeconv_called_once_per_generator) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .p_localeconv = &my_localeconv_with_cnt,
+    };
+    std::unique_ptr<JsonStreamGenWrapper> p_wrapper = std::make_unique<JsonStreamGenWrapper>(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_FLOAT(p_gen, "key0", 1.234f);
+            JSON_STREAM_GEN_ADD_FLOAT_WITH_PRECISION(p_gen, "key1", 1.234f, 2);
+            JSON_STREAM_GEN_ADD_FLOAT_FIXED_POINT(p_gen, "key2", 1.234f, JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_2);
+            JSON_STREAM_GEN_ADD_DOUBLE(p_gen, "key3", 1.234);
+            JSON_STREAM_GEN_ADD_DOUBLE_WITH_PRECISION(p_gen, "key4", 1.234, 2);
+            JSON_STREAM_GEN_ADD_DOUBLE_FIXED_POINT(p_gen, "key5", 1.234, JSON_STREAM_GEN_NUM_DECIMALS_DOUBLE_2);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = p_wrapper->get();
+    ASSERT_EQ(1U, this->m_cnt_localeconv);
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{\"key0\":1.234,\"key1\":1.2,\"key2\":1.23,\"key3\":1.234,\"key4\":1.2,\"key5\":1.23}"),
+        string(p_chunk));
+    ASSERT_EQ(1U, this->m_cnt_localeconv);
+
+    json_stream_gen_refresh_locale(p_gen);
+    ASSERT_EQ(2U, this->m_cnt_localeconv);
+
+    json_stream_gen_reset(p_gen);
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{\"key0\":1.234,\"key1\":1.2,\"key2\":1.23,\"key3\":1.234,\"key4\":1.2,\"key5\":1.23}"),
+        string(p_chunk));
+    ASSERT_EQ(2U, this->m_cnt_localeconv);
+}
+
 TEST_F(TestJsonStreamGenC, test_float_nan_inf) // NOLINT
 {
     json_stream_gen_cfg_t cfg = {
@@ -0,0 +1,278 @@
+/**
+ * @file test_json_stream_gen_coro.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen_coro.hpp"
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenCoro;
+static TestJsonStreamGenCoro* g_pTestClass;
+
+class TestJsonStreamGenCoro : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenCoro();
+
+    ~TestJsonStreamGenCoro() override;
+};
+
+TestJsonStreamGenCoro::TestJsonStreamGenCoro()
+    : Test()
+{
+}
+
+TestJsonStreamGenCoro::~TestJsonStreamGenCoro() = default;
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+#define TEST_CORO_NUM_VALUES (40U)
+
+typedef struct test_coro_data_t
+{
+    const char* p_name;
+    int32_t     values[TEST_CORO_NUM_VALUES];
+    double      temperature;
+    bool        flag_has_temperature;
+    uint32_t    cnt_item_calls;
+} test_coro_data_t;
+
+static void
+init_coro_data(test_coro_data_t* const p_data)
+{
+    p_data->p_name = "sensor\twith \"escaped\" name";
+    for (uint32_t i = 0; i < TEST_CORO_NUM_VALUES; ++i)
+    {
+        p_data->values[i] = (int32_t)(i * i * 1001) - 50000;
+    }
+    p_data->temperature          = 21.5;
+    p_data->flag_has_temperature = true;
+    p_data->cnt_item_calls       = 0;
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    cb_generate_json_values,
+    json_stream_gen_t* const      p_gen,
+    const test_coro_data_t* const p_data,
+    const uint32_t                begin_idx,
+    const uint32_t                end_idx)
+{
+    for (uint32_t i = begin_idx; i < end_idx; ++i)
+    {
+        JSON_STREAM_GEN_ADD_INT32_TO_ARRAY(p_gen, p_data->values[i]);
+    }
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_data = static_cast<const test_coro_data_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "name", p_data->p_name);
+    if (p_data->flag_has_temperature)
+    {
+        JSON_STREAM_GEN_ADD_DOUBLE(p_gen, "temperature", p_data->temperature);
+    }
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "values");
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "first");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(cb_generate_json_values, p_gen, p_data, 0, TEST_CORO_NUM_VALUES / 2);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "second");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(
+        cb_generate_json_values,
+        p_gen,
+        p_data,
+        TEST_CORO_NUM_VALUES / 2,
+        TEST_CORO_NUM_VALUES);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_ADD_INT32_ARRAY(p_gen, "all", p_data->values, TEST_CORO_NUM_VALUES);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static json_stream_gen::Coroutine
+coro_generate_json_values(
+    json_stream_gen_t* const p_gen,
+    test_coro_data_t* const  p_data,
+    const uint32_t           begin_idx,
+    const uint32_t           end_idx)
+{
+    for (uint32_t i = begin_idx; i < end_idx; ++i)
+    {
+        co_yield [&] {
+            p_data->cnt_item_calls += 1;
+            return json_stream_gen_add_int32(p_gen, nullptr, p_data->values[i]);
+        };
+    }
+}
+
+static json_stream_gen::Coroutine
+coro_generate_json(json_stream_gen_t* const p_gen, test_coro_data_t* const p_data)
+{
+    co_yield json_stream_gen::item(&json_stream_gen_add_string, p_gen, "name", p_data->p_name);
+    if (p_data->flag_has_temperature)
+    {
+        co_yield json_stream_gen::item(&json_stream_gen_add_double, p_gen, "temperature", p_data->temperature, -1);
+    }
+    co_yield json_stream_gen::item(&json_stream_gen_start_object, p_gen, "values");
+    const char* const p_array_names[2] = { "first", "second" };
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        const uint32_t begin_idx = i * (TEST_CORO_NUM_VALUES / 2);
+        co_yield json_stream_gen::item(&json_stream_gen_start_array, p_gen, p_array_names[i]);
+        // A nested coroutine is driven by the outer one.
+        json_stream_gen::Coroutine sub_coro = coro_generate_json_values(
+            p_gen,
+            p_data,
+            begin_idx,
+            begin_idx + (TEST_CORO_NUM_VALUES / 2));
+        co_yield [&] { return JSON_STREAM_GEN_CALLBACK_RESULT_FINISH == sub_coro.resume().cb_res; };
+        co_yield json_stream_gen::item(&json_stream_gen_end_array, p_gen);
+    }
+    co_yield json_stream_gen::item(&json_stream_gen_end_object, p_gen);
+    co_yield json_stream_gen::item(
+        &json_stream_gen_add_int32_array,
+        p_gen,
+        "all",
+        p_data->values,
+        (size_t)TEST_CORO_NUM_VALUES);
+}
+
+static vector<string>
+generate_chunks(json_stream_gen_t* const p_gen, const json_stream_gen_size_t max_chunk_size)
+{
+    vector<string> chunks;
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            chunks.emplace_back("<error>");
+            break;
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        if (strlen(p_chunk) >= (size_t)max_chunk_size)
+        {
+            chunks.emplace_back("<chunk overflow>");
+            break;
+        }
+        chunks.emplace_back(p_chunk);
+    }
+    return chunks;
+}
+
+static void
+check_coro_generator(const bool flag_formatted_json)
+{
+    for (json_stream_gen_size_t max_chunk_size = 200; max_chunk_size >= 48; max_chunk_size--)
+    {
+        const json_stream_gen_cfg_t cfg = {
+            .max_chunk_size      = max_chunk_size,
+            .flag_formatted_json = flag_formatted_json,
+        };
+        test_coro_data_t*    p_data  = nullptr;
+        JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json, sizeof(*p_data), (void**)&p_data);
+        init_coro_data(p_data);
+        const vector<string> expected_chunks = generate_chunks(wrapper.get(), max_chunk_size);
+        ASSERT_LT(1U, expected_chunks.size());
+        ASSERT_NE(string("<error>"), expected_chunks.back());
+
+        test_coro_data_t data = {};
+        init_coro_data(&data);
+        json_stream_gen::CoroGenerator gen(&cfg, [&data](json_stream_gen_t* const p_gen) {
+            return coro_generate_json(p_gen, &data);
+        });
+        ASSERT_EQ(expected_chunks, generate_chunks(gen.get(), max_chunk_size)) << "max_chunk_size=" << max_chunk_size;
+
+        // The items added in the previous chunks are not re-walked, only the item which did not fit is added again.
+        ASSERT_GE(TEST_CORO_NUM_VALUES + expected_chunks.size(), data.cnt_item_calls);
+
+        // The generator is restarted after reset.
+        json_stream_gen_reset(gen.get());
+        ASSERT_EQ(expected_chunks, generate_chunks(gen.get(), max_chunk_size)) << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+TEST_F(TestJsonStreamGenCoro, test_coro_generator_unformatted) // NOLINT
+{
+    check_coro_generator(false);
+}
+
+TEST_F(TestJsonStreamGenCoro, test_coro_generator_formatted) // NOLINT
+{
+    check_coro_generator(true);
+}
+
+TEST_F(TestJsonStreamGenCoro, test_coro_generator_calc_size_and_seek) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 64,
+    };
+    test_coro_data_t data = {};
+    init_coro_data(&data);
+    json_stream_gen::CoroGenerator gen(&cfg, [&data](json_stream_gen_t* const p_gen) {
+        return coro_generate_json(p_gen, &data);
+    });
+    string expected_json("");
+    for (const string& chunk : generate_chunks(gen.get(), cfg.max_chunk_size))
+    {
+        expected_json += chunk;
+    }
+    json_stream_gen_reset(gen.get());
+    ASSERT_EQ((json_stream_gen_size_t)expected_json.size(), json_stream_gen_calc_size(gen.get()));
+
+    for (size_t offset = 0; offset <= expected_json.size(); offset += 7)
+    {
+        ASSERT_TRUE(json_stream_gen_seek(gen.get(), (json_stream_gen_size_t)offset));
+        string json_str("");
+        for (const string& chunk : generate_chunks(gen.get(), cfg.max_chunk_size))
+        {
+            json_str += chunk;
+        }
+        ASSERT_EQ(expected_json.substr(offset), json_str) << "offset=" << offset;
+    }
+}
+
+TEST_F(TestJsonStreamGenCoro, test_coro_generator_insufficient_buffer) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 10,
+    };
+    json_stream_gen::CoroGenerator gen(&cfg, [](json_stream_gen_t* const p_gen) -> json_stream_gen::Coroutine {
+        co_yield json_stream_gen::item(&json_stream_gen_add_bool, p_gen, "a", true);
+        co_yield json_stream_gen::item(&json_stream_gen_add_string, p_gen, "s", "0123456789");
+    });
+    const char* p_chunk = json_stream_gen_get_next_chunk(gen.get());
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"a\":true"), string(p_chunk));
+    ASSERT_EQ(nullptr, json_stream_gen_get_next_chunk(gen.get()));
+}
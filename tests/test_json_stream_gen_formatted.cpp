@@ -1267,13 +1267,13 @@ TEST_F(TestJsonStreamGenF, test_generate_json_floats) // NOLINT
                "  \"key_-16777215.0\": -16777215,\n"
                "  \"key_16777216.0\": 16777216,\n"
                "  \"key_-16777216.0\": -16777216,\n"
-               "  \"key_0.12345678\": 0.123456784,\n"   // 0.12345678 -> 0.123456784
-               "  \"key_-0.12345678\": -0.123456784,\n" // -0.12345678 -> -0.123456784
+               "  \"key_0.12345678\": 0.12345678,\n"
+               "  \"key_-0.12345678\": -0.12345678,\n"
                "  \"key_100000.9\": 100000.9,\n"
-               "  \"key_100000.99\": 100000.992,\n"
+               "  \"key_100000.99\": 100000.99,\n"
                "  \"key_100000.999\": 100001,\n"
                "  \"key_-100000.9\": -100000.9,\n"
-               "  \"key_-100000.99\": -100000.992,\n"
+               "  \"key_-100000.99\": -100000.99,\n"
                "  \"key_-100000.999\": -100001\n"
                "}"),
         string(p_chunk));
@@ -1392,7 +1392,7 @@ TEST_F(TestJsonStreamGenF, test_generate_json_doubles) // NOLINT
                "  \"key_0.0\": 0,\n"
                "  \"key_0.1\": 0.1,\n"
                "  \"key_0.3\": 0.3,\n"
-               "  \"key_0.5555555555555555\": 0.55555555555555547,\n" // 0.5555555555555555 -> 0.55555555555555547
+               "  \"key_0.5555555555555555\": 0.5555555555555555,\n"
                "  \"key_1.0\": 1,\n"
                "  \"key_-1.0\": -1,\n"
                "  \"key_9007199254740992.0\": 9007199254740992,\n"
@@ -1402,11 +1402,11 @@ TEST_F(TestJsonStreamGenF, test_generate_json_doubles) // NOLINT
                "  \"key_0.12345678912345678\": 0.12345678912345678,\n"
                "  \"key_-0.12345678912345678\": -0.12345678912345678,\n"
                "  \"key_16777215.9999999\": 16777215.9999999,\n"
-               "  \"key_16777215.99999999\": 16777215.999999991,\n"
+               "  \"key_16777215.99999999\": 16777215.99999999,\n"
                "  \"key_16777215.999999999\": 16777215.999999998,\n"
                "  \"key_16777215.9999999999\": 16777216,\n"
                "  \"key_-16777215.9999999\": -16777215.9999999,\n"
-               "  \"key_-16777215.99999999\": -16777215.999999991,\n"
+               "  \"key_-16777215.99999999\": -16777215.99999999,\n"
                "  \"key_-16777215.999999999\": -16777215.999999998,\n"
                "  \"key_-16777215.9999999999\": -16777216\n"
                "}"),
@@ -0,0 +1,196 @@
+/**
+ * @file test_json_stream_gen_resumable.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen.h"
+#include "gtest/gtest.h"
+#include <string>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenR;
+static TestJsonStreamGenR* g_pTestClass;
+
+class TestJsonStreamGenR : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenR();
+
+    ~TestJsonStreamGenR() override;
+};
+
+TestJsonStreamGenR::TestJsonStreamGenR()
+    : Test()
+{
+}
+
+TestJsonStreamGenR::~TestJsonStreamGenR() = default;
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+#define TEST_RESUMABLE_ARRAY_SIZE (50U)
+
+typedef struct generate_resumable_t
+{
+    uint32_t array[TEST_RESUMABLE_ARRAY_SIZE];
+    uint32_t idx;
+    uint32_t cnt_loop_iterations;
+} generate_resumable_t;
+
+static json_stream_gen_callback_result_t
+cb_generate_resumable(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<generate_resumable_t*>(const_cast<void*>(p_user_ctx));
+    JSON_STREAM_GEN_BEGIN_RESUMABLE_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "key1", "val1");
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+    for (p_ctx->idx = 0; p_ctx->idx < TEST_RESUMABLE_ARRAY_SIZE; ++p_ctx->idx)
+    {
+        JSON_STREAM_GEN_RESUME_POINT(p_gen);
+        p_ctx->cnt_loop_iterations += 1;
+        JSON_STREAM_GEN_ADD_UINT32_TO_ARRAY(p_gen, p_ctx->array[p_ctx->idx]);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_RESUME_POINT(p_gen);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "key2", true);
+    JSON_STREAM_GEN_END_RESUMABLE_GENERATOR_FUNC();
+}
+
+static string
+get_expected_resumable_json(const generate_resumable_t* const p_ctx)
+{
+    string json_str("{\"key1\":\"val1\",\"arr\":[");
+    for (uint32_t i = 0; i < TEST_RESUMABLE_ARRAY_SIZE; ++i)
+    {
+        if (0 != i)
+        {
+            json_str += ",";
+        }
+        json_str += to_string(p_ctx->array[i]);
+    }
+    json_str += "],\"key2\":true}";
+    return json_str;
+}
+
+TEST_F(TestJsonStreamGenR, test_resumable_generator) // NOLINT
+{
+    for (json_stream_gen_size_t max_chunk_size = 100; max_chunk_size >= 16; max_chunk_size--)
+    {
+        json_stream_gen_cfg_t cfg = {
+            .max_chunk_size = max_chunk_size,
+        };
+        generate_resumable_t*                 p_ctx     = nullptr;
+        std::unique_ptr<JsonStreamGenWrapper> p_wrapper = std::make_unique<JsonStreamGenWrapper>(
+            &cfg,
+            &cb_generate_resumable,
+            sizeof(*p_ctx),
+            (void**)&p_ctx);
+        ASSERT_NE(nullptr, p_ctx);
+        for (uint32_t i = 0; i < TEST_RESUMABLE_ARRAY_SIZE; ++i)
+        {
+            p_ctx->array[i] = 1000U + i * 7U;
+        }
+        json_stream_gen_t* p_gen = p_wrapper->get();
+
+        string   json_str("");
+        uint32_t cnt_chunks = 0;
+        while (true)
+        {
+            const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+            ASSERT_NE(nullptr, p_chunk);
+            if ('\0' == p_chunk[0])
+            {
+                break;
+            }
+            ASSERT_LT(strlen(p_chunk), (size_t)max_chunk_size);
+            json_str += string(p_chunk);
+            cnt_chunks += 1;
+        }
+        ASSERT_EQ(get_expected_resumable_json(p_ctx), json_str);
+        // Each chunk re-walks at most one array element that did not fit into the previous chunk.
+        ASSERT_LE(p_ctx->cnt_loop_iterations, TEST_RESUMABLE_ARRAY_SIZE + cnt_chunks);
+    }
+}
+
+TEST_F(TestJsonStreamGenR, test_resumable_generator_calc_size_and_reset) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 32,
+    };
+    generate_resumable_t* p_ctx   = nullptr;
+    JsonStreamGenWrapper  wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_resumable, sizeof(*p_ctx), (void**)&p_ctx);
+    ASSERT_NE(nullptr, p_ctx);
+    for (uint32_t i = 0; i < TEST_RESUMABLE_ARRAY_SIZE; ++i)
+    {
+        p_ctx->array[i] = i;
+    }
+    json_stream_gen_t* p_gen    = wrapper.get();
+    const string       expected = get_expected_resumable_json(p_ctx);
+
+    ASSERT_EQ((json_stream_gen_size_t)expected.size(), json_stream_gen_calc_size(p_gen));
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"key1\":\"val1\",\"arr\":[0,1,2,3,4"), string(p_chunk));
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",5,6,7,8,9,10,11,12,13,14,15,16"), string(p_chunk));
+
+    json_stream_gen_reset(p_gen);
+
+    string json_str("");
+    while (true)
+    {
+        p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        ASSERT_NE(nullptr, p_chunk);
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        json_str += string(p_chunk);
+    }
+    ASSERT_EQ(expected, json_str);
+}
+
+TEST_F(TestJsonStreamGenR, test_resumable_generator_empty) // NOLINT
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        nullptr,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_RESUMABLE_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_END_RESUMABLE_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{}"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_EQ(string(""), string(p_chunk));
+}
@@ -0,0 +1,246 @@
+/**
+ * @file test_json_stream_gen_seek.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen.h"
+#include "gtest/gtest.h"
+#include <string>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenSeek;
+static TestJsonStreamGenSeek* g_pTestClass;
+
+class TestJsonStreamGenSeek : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenSeek();
+
+    ~TestJsonStreamGenSeek() override;
+};
+
+TestJsonStreamGenSeek::TestJsonStreamGenSeek()
+    : Test()
+{
+}
+
+TestJsonStreamGenSeek::~TestJsonStreamGenSeek() = default;
+
+static string
+generate_json(json_stream_gen_t* const p_gen, const json_stream_gen_size_t max_chunk_size)
+{
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            return string("<error>");
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        if (strlen(p_chunk) >= (size_t)max_chunk_size)
+        {
+            return string("<chunk overflow>");
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    cb_generate_json_sub_obj,
+    json_stream_gen_t* const p_gen,
+    const void* const        p_user_ctx)
+{
+    (void)p_user_ctx;
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "key1", 100);
+    JSON_STREAM_GEN_ADD_DOUBLE(p_gen, "key2", 2.718281828459045);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    static const uint32_t g_arr[] = { 0, 1, 22, 333, 4444, 55555, 666666, 7777777, 88888888, 999999999 };
+    static const uint8_t  g_buf[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45, 0x67 };
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "str", "value\twith\"escaping\"");
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "obj");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_sub_obj, p_gen, p_user_ctx);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_ADD_UINT32_ARRAY(p_gen, "arr", g_arr, sizeof(g_arr) / sizeof(g_arr[0]));
+    JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "hex", g_buf, sizeof(g_buf));
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "floats");
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        JSON_STREAM_GEN_ADD_FLOAT_TO_ARRAY(p_gen, (float)i * 1.1f);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "bool", true);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_seek(json_stream_gen_cfg_t cfg)
+{
+    const json_stream_gen_size_t max_chunk_size = cfg.max_chunk_size;
+
+    cfg.max_chunk_size                 = 4096;
+    JsonStreamGenWrapper wrapper       = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    const string         expected_json = generate_json(wrapper.get(), cfg.max_chunk_size);
+    ASSERT_EQ('{', expected_json[0]);
+
+    cfg.max_chunk_size = max_chunk_size;
+    JsonStreamGenWrapper wrapper_seek(&cfg, &cb_generate_json, 0, nullptr);
+    json_stream_gen_t*   p_gen = wrapper_seek.get();
+    for (size_t offset = 0; offset <= expected_json.size(); ++offset)
+    {
+        ASSERT_TRUE(json_stream_gen_seek(p_gen, (json_stream_gen_size_t)offset)) << "offset=" << offset;
+        ASSERT_EQ(expected_json.substr(offset), generate_json(p_gen, max_chunk_size)) << "offset=" << offset;
+    }
+    ASSERT_FALSE(json_stream_gen_seek(p_gen, (json_stream_gen_size_t)expected_json.size() + 1));
+    ASSERT_EQ(expected_json, generate_json(p_gen, max_chunk_size));
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_unformatted) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 40,
+    };
+    check_seek(cfg);
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_formatted) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = 64,
+        .flag_formatted_json = true,
+    };
+    check_seek(cfg);
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_with_sub_func_cache_and_spill_buf) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = 40,
+        .sub_func_cache_size = 4,
+        .spill_buf_size      = 40,
+    };
+    check_seek(cfg);
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_with_split_long_values) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 30,
+        .flag_split_long_values = true,
+    };
+    check_seek(cfg);
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_with_packed_chunks) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 32,
+        .flag_split_long_values = true,
+        .flag_pack_chunks       = true,
+    };
+    check_seek(cfg);
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_in_the_middle_of_generation) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 16,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "key1", 1234567);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "key2", 2345678);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "key3", 3456789);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"key1\":1234567"), string(p_chunk));
+
+    ASSERT_TRUE(json_stream_gen_seek(p_gen, 20));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("2\":2345678"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",\"key3\":3456789"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("}"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+
+    ASSERT_FALSE(json_stream_gen_seek(p_gen, -1));
+}
+
+TEST_F(TestJsonStreamGenSeek, test_seek_with_insufficient_buffer) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 10,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_BOOL(p_gen, "a", true);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "s", "0123456789");
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    // The seek offset is before the item which does not fit into the chunk.
+    ASSERT_TRUE(json_stream_gen_seek(p_gen, 3));
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("\":true"), string(p_chunk));
+    ASSERT_EQ(nullptr, json_stream_gen_get_next_chunk(p_gen));
+}
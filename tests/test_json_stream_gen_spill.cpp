@@ -0,0 +1,381 @@
+/**
+ * @file test_json_stream_gen_spill.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenSP;
+static TestJsonStreamGenSP* g_pTestClass;
+
+class TestJsonStreamGenSP : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass           = this;
+        this->m_cnt_localeconv = 0;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenSP();
+
+    ~TestJsonStreamGenSP() override;
+
+    uint32_t m_cnt_localeconv {};
+};
+
+TestJsonStreamGenSP::TestJsonStreamGenSP()
+    : Test()
+{
+}
+
+TestJsonStreamGenSP::~TestJsonStreamGenSP() = default;
+
+extern "C" {
+
+static struct lconv*
+my_localeconv(void)
+{
+    g_pTestClass->m_cnt_localeconv += 1;
+    return localeconv();
+}
+
+} // extern "C"
+
+static vector<string>
+generate_chunks(json_stream_gen_t* const p_gen, const json_stream_gen_size_t max_chunk_size)
+{
+    vector<string> chunks;
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            chunks.emplace_back("<error>");
+            break;
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        if (strlen(p_chunk) >= (size_t)max_chunk_size)
+        {
+            chunks.emplace_back("<chunk overflow>");
+            break;
+        }
+        chunks.emplace_back(p_chunk);
+    }
+    return chunks;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+#define TEST_SPILL_NUM_FLOATS (24U)
+
+static json_stream_gen_callback_result_t
+cb_generate_json(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    (void)p_user_ctx;
+    static const uint8_t g_buf[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF };
+    static const int32_t g_arr[] = { -1, 0, 1, 2147483647 };
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "str", "value\twith\"escaping\"");
+    JSON_STREAM_GEN_ADD_RAW_STRING(p_gen, "raw", "raw_value");
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "obj");
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "i32", -123456);
+    JSON_STREAM_GEN_ADD_UINT64(p_gen, "u64", 18446744073709551615ULL);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "bool", true);
+    JSON_STREAM_GEN_ADD_NULL(p_gen, "null");
+    JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "hex", g_buf, sizeof(g_buf));
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "floats");
+    for (uint32_t i = 0; i < TEST_SPILL_NUM_FLOATS; ++i)
+    {
+        JSON_STREAM_GEN_ADD_FLOAT_TO_ARRAY(p_gen, (float)i * 1.1f);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_ADD_INT32_ARRAY(p_gen, "arr", g_arr, sizeof(g_arr) / sizeof(g_arr[0]));
+    JSON_STREAM_GEN_ADD_DOUBLE(p_gen, "double", 3.14159265358979);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_spill_buf(const bool flag_formatted_json, const json_stream_gen_size_t spill_buf_size)
+{
+    for (json_stream_gen_size_t max_chunk_size = 200; max_chunk_size >= 32; max_chunk_size--)
+    {
+        json_stream_gen_cfg_t cfg = {
+            .max_chunk_size      = max_chunk_size,
+            .flag_formatted_json = flag_formatted_json,
+        };
+        JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+        cfg.spill_buf_size           = spill_buf_size;
+        JsonStreamGenWrapper wrapper_spill(&cfg, &cb_generate_json, 0, nullptr);
+
+        const vector<string> expected_chunks = generate_chunks(wrapper.get(), max_chunk_size);
+        ASSERT_LT(1U, expected_chunks.size());
+        ASSERT_EQ(expected_chunks, generate_chunks(wrapper_spill.get(), max_chunk_size))
+            << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+TEST_F(TestJsonStreamGenSP, test_spill_buf_unformatted) // NOLINT
+{
+    check_spill_buf(false, JSON_STREAM_GEN_CFG_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+TEST_F(TestJsonStreamGenSP, test_spill_buf_formatted) // NOLINT
+{
+    check_spill_buf(true, JSON_STREAM_GEN_CFG_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+TEST_F(TestJsonStreamGenSP, test_small_spill_buf_unformatted) // NOLINT
+{
+    check_spill_buf(false, 8);
+}
+
+TEST_F(TestJsonStreamGenSP, test_small_spill_buf_formatted) // NOLINT
+{
+    check_spill_buf(true, 8);
+}
+
+typedef struct test_spill_iter_ctx_t
+{
+    uint32_t cnt_calls;
+} test_spill_iter_ctx_t;
+
+static json_stream_gen_iter_result_t
+cb_iter_next_float(json_stream_gen_t* const p_gen, void* const p_iter_ctx, const size_t idx)
+{
+    auto p_ctx = static_cast<test_spill_iter_ctx_t*>(p_iter_ctx);
+    p_ctx->cnt_calls += 1;
+    if (idx >= TEST_SPILL_NUM_FLOATS)
+    {
+        return (json_stream_gen_iter_result_t) { .iter_res = JSON_STREAM_GEN_ITER_RESULT_END };
+    }
+    if (!json_stream_gen_add_float(p_gen, NULL, (float)idx * 1.1f, -1))
+    {
+        return (json_stream_gen_iter_result_t) { .iter_res = JSON_STREAM_GEN_ITER_RESULT_OVERFLOW };
+    }
+    return (json_stream_gen_iter_result_t) { .iter_res = JSON_STREAM_GEN_ITER_RESULT_NEXT };
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_floats_from_iterator(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<test_spill_iter_ctx_t*>(const_cast<void*>(p_user_ctx));
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_ARRAY_FROM_ITERATOR(p_gen, "floats", &cb_iter_next_float, p_ctx);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+TEST_F(TestJsonStreamGenSP, test_spill_buf_avoids_formatting_item_again) // NOLINT
+{
+    for (json_stream_gen_size_t max_chunk_size = 64; max_chunk_size >= 16; max_chunk_size--)
+    {
+        json_stream_gen_cfg_t cfg = {
+            .max_chunk_size = max_chunk_size,
+        };
+        test_spill_iter_ctx_t* p_ctx   = nullptr;
+        JsonStreamGenWrapper   wrapper = JsonStreamGenWrapper(
+            &cfg,
+            &cb_generate_json_floats_from_iterator,
+            sizeof(*p_ctx),
+            (void**)&p_ctx);
+        const vector<string> chunks = generate_chunks(wrapper.get(), max_chunk_size);
+        ASSERT_LT(1U, chunks.size());
+        ASSERT_NE(string("<error>"), chunks.back());
+        // Without the spill buffer, the element which does not fit into the chunk is formatted again.
+        ASSERT_LT(TEST_SPILL_NUM_FLOATS + 1, p_ctx->cnt_calls) << "max_chunk_size=" << max_chunk_size;
+
+        cfg.spill_buf_size                 = max_chunk_size;
+        test_spill_iter_ctx_t* p_ctx_spill = nullptr;
+        JsonStreamGenWrapper   wrapper_spill(
+            &cfg,
+            &cb_generate_json_floats_from_iterator,
+            sizeof(*p_ctx_spill),
+            (void**)&p_ctx_spill);
+        ASSERT_EQ(chunks, generate_chunks(wrapper_spill.get(), max_chunk_size));
+        // Every element is formatted once, and the iterator is called once more to find the end of the array.
+        ASSERT_EQ(TEST_SPILL_NUM_FLOATS + 1, p_ctx_spill->cnt_calls) << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+TEST_F(TestJsonStreamGenSP, test_spill_buf_with_floats_does_not_query_locale) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 32,
+        .p_localeconv   = &my_localeconv,
+        .spill_buf_size = 32,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    const vector<string> chunks  = generate_chunks(wrapper.get(), cfg.max_chunk_size);
+    ASSERT_LT(1U, chunks.size());
+    ASSERT_NE(string("<error>"), chunks.back());
+    // The decimal point is obtained only once when the generator is created.
+    ASSERT_EQ(1U, this->m_cnt_localeconv);
+}
+
+TEST_F(TestJsonStreamGenSP, test_spill_buf_item_larger_than_chunk) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 16,
+        .spill_buf_size = 16,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_BOOL(p_gen, "k", true);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "key", "very_long_value");
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"k\":true"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_EQ(nullptr, p_chunk);
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_with_long_values(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    (void)p_user_ctx;
+    static const uint8_t g_buf[] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC,
+                                     0xDD, 0xEE, 0xFF, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99,
+                                     0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55 };
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "bool", false);
+    JSON_STREAM_GEN_ADD_STRING(
+        p_gen,
+        "str",
+        "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.");
+    JSON_STREAM_GEN_ADD_STRING(
+        p_gen,
+        "esc",
+        "\"line1\"\n\"line2\"\n\"line3\"\n\"line4\"\n\"line5\"\n\"line6\"\n\x01\x02\x03\x04\x05\x06\x07\x08");
+    JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "hex", g_buf, sizeof(g_buf));
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "u32", 4294967295U);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_pack_chunks(const json_stream_gen_cb_generate_next_t cb_gen_next, const bool flag_formatted_json)
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 4096,
+        .flag_formatted_json    = flag_formatted_json,
+        .flag_split_long_values = true,
+    };
+    JsonStreamGenWrapper wrapper      = JsonStreamGenWrapper(&cfg, cb_gen_next, 0, nullptr);
+    const vector<string> whole_chunks = generate_chunks(wrapper.get(), cfg.max_chunk_size);
+    ASSERT_EQ(1U, whole_chunks.size());
+    const string& expected_json = whole_chunks[0];
+
+    uint32_t num_checked_chunk_sizes = 0;
+    for (json_stream_gen_size_t max_chunk_size = 200; max_chunk_size >= JSON_STREAM_GEN_CFG_MIN_CHUNK_SIZE;
+         max_chunk_size--)
+    {
+        cfg.max_chunk_size   = max_chunk_size;
+        cfg.flag_pack_chunks = false;
+        JsonStreamGenWrapper wrapper_unpacked(&cfg, cb_gen_next, 0, nullptr);
+        cfg.flag_pack_chunks = true;
+        JsonStreamGenWrapper wrapper_packed(&cfg, cb_gen_next, 0, nullptr);
+
+        const vector<string> unpacked_chunks = generate_chunks(wrapper_unpacked.get(), max_chunk_size);
+        const vector<string> chunks          = generate_chunks(wrapper_packed.get(), max_chunk_size);
+        ASSERT_FALSE(chunks.empty());
+        if ("<error>" == unpacked_chunks.back())
+        {
+            // Packing does not help if some item does not fit even into the empty chunk.
+            ASSERT_EQ(string("<error>"), chunks.back()) << "max_chunk_size=" << max_chunk_size;
+            continue;
+        }
+        num_checked_chunk_sizes += 1;
+        string json_str("");
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            if ((i + 1) != chunks.size())
+            {
+                ASSERT_EQ((size_t)max_chunk_size - 1, chunks[i].size())
+                    << "max_chunk_size=" << max_chunk_size << ", chunk " << i << ": " << chunks[i];
+            }
+            json_str += chunks[i];
+        }
+        ASSERT_EQ(expected_json, json_str) << "max_chunk_size=" << max_chunk_size;
+        ASSERT_LE(chunks.size(), unpacked_chunks.size());
+        json_stream_gen_reset(wrapper_packed.get());
+        ASSERT_EQ((json_stream_gen_size_t)expected_json.size(), json_stream_gen_calc_size(wrapper_packed.get()));
+    }
+    ASSERT_LT(150U, num_checked_chunk_sizes);
+}
+
+TEST_F(TestJsonStreamGenSP, test_pack_chunks_unformatted) // NOLINT
+{
+    check_pack_chunks(&cb_generate_json, false);
+}
+
+TEST_F(TestJsonStreamGenSP, test_pack_chunks_formatted) // NOLINT
+{
+    check_pack_chunks(&cb_generate_json, true);
+}
+
+TEST_F(TestJsonStreamGenSP, test_pack_chunks_with_long_values_unformatted) // NOLINT
+{
+    check_pack_chunks(&cb_generate_json_with_long_values, false);
+}
+
+TEST_F(TestJsonStreamGenSP, test_pack_chunks_with_long_values_formatted) // NOLINT
+{
+    check_pack_chunks(&cb_generate_json_with_long_values, true);
+}
+
+TEST_F(TestJsonStreamGenSP, test_pack_chunks) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size   = 8,
+        .flag_pack_chunks = true,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "a", 1);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "b", 2);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "c", 3);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    const vector<string> chunks   = generate_chunks(wrapper.get(), cfg.max_chunk_size);
+    const vector<string> expected = { "{\"a\":1,", "\"b\":2,\"", "c\":3}" };
+    ASSERT_EQ(expected, chunks);
+}
@@ -0,0 +1,252 @@
+/**
+ * @file test_json_stream_gen_split.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen.h"
+#include "gtest/gtest.h"
+#include <string>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenSplit;
+static TestJsonStreamGenSplit* g_pTestClass;
+
+class TestJsonStreamGenSplit : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenSplit();
+
+    ~TestJsonStreamGenSplit() override;
+};
+
+TestJsonStreamGenSplit::TestJsonStreamGenSplit()
+    : Test()
+{
+}
+
+TestJsonStreamGenSplit::~TestJsonStreamGenSplit() = default;
+
+static string
+generate_json(json_stream_gen_t* const p_gen, const json_stream_gen_size_t max_chunk_size)
+{
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            return string("<error>");
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        if (strlen(p_chunk) >= (size_t)max_chunk_size)
+        {
+            return string("<chunk overflow>");
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+#define TEST_SPLIT_STR_LEN (150U)
+#define TEST_SPLIT_BUF_LEN (100U)
+
+typedef struct test_split_ctx_t
+{
+    char    raw_str[TEST_SPLIT_STR_LEN + 1];
+    char    escaped_str[TEST_SPLIT_STR_LEN + 1];
+    uint8_t buf[TEST_SPLIT_BUF_LEN];
+} test_split_ctx_t;
+
+static void
+init_split_ctx(test_split_ctx_t* const p_ctx)
+{
+    for (uint32_t i = 0; i < TEST_SPLIT_STR_LEN; ++i)
+    {
+        p_ctx->raw_str[i]     = (char)('a' + (i % 26));
+        p_ctx->escaped_str[i] = (0 == (i % 10)) ? '\n' : ((0 == (i % 7)) ? '\x01' : (char)('A' + (i % 26)));
+    }
+    p_ctx->raw_str[TEST_SPLIT_STR_LEN]     = '\0';
+    p_ctx->escaped_str[TEST_SPLIT_STR_LEN] = '\0';
+    for (uint32_t i = 0; i < TEST_SPLIT_BUF_LEN; ++i)
+    {
+        p_ctx->buf[i] = (uint8_t)(i * 37U);
+    }
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_long_values(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<const test_split_ctx_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "key1", true);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "raw", p_ctx->raw_str);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "obj");
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "escaped", p_ctx->escaped_str);
+    JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "hex", p_ctx->buf, sizeof(p_ctx->buf));
+    JSON_STREAM_GEN_ADD_BASE64(p_gen, "b64", p_ctx->buf, sizeof(p_ctx->buf));
+    JSON_STREAM_GEN_ADD_BASE64URL(p_gen, "b64url", p_ctx->buf, sizeof(p_ctx->buf) - 1);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+    JSON_STREAM_GEN_ADD_RAW_STRING_TO_ARRAY(p_gen, p_ctx->raw_str);
+    JSON_STREAM_GEN_ADD_HEX_BUF_TO_ARRAY(p_gen, p_ctx->buf, sizeof(p_ctx->buf));
+    JSON_STREAM_GEN_ADD_BASE64_TO_ARRAY(p_gen, p_ctx->buf, sizeof(p_ctx->buf) - 2);
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "key2", 123);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_split_long_values(const bool flag_formatted_json, const json_stream_gen_size_t spill_buf_size)
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = 4096,
+        .flag_formatted_json = flag_formatted_json,
+    };
+    test_split_ctx_t*    p_ctx   = nullptr;
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        &cb_generate_long_values,
+        sizeof(*p_ctx),
+        (void**)&p_ctx);
+    init_split_ctx(p_ctx);
+    const string expected_json = generate_json(wrapper.get(), cfg.max_chunk_size);
+    ASSERT_EQ('{', expected_json[0]);
+
+    // The prefix of the value (the name and the indentation) can't be split, so it must fit into the chunk.
+    for (json_stream_gen_size_t max_chunk_size = 300; max_chunk_size >= 20; max_chunk_size--)
+    {
+        cfg.max_chunk_size         = max_chunk_size;
+        cfg.spill_buf_size         = spill_buf_size;
+        cfg.flag_split_long_values = true;
+        test_split_ctx_t*    p_ctx_split   = nullptr;
+        JsonStreamGenWrapper wrapper_split = JsonStreamGenWrapper(
+            &cfg,
+            &cb_generate_long_values,
+            sizeof(*p_ctx_split),
+            (void**)&p_ctx_split);
+        init_split_ctx(p_ctx_split);
+        ASSERT_EQ(expected_json, generate_json(wrapper_split.get(), max_chunk_size))
+            << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+TEST_F(TestJsonStreamGenSplit, test_split_long_values_unformatted) // NOLINT
+{
+    check_split_long_values(false, 0);
+}
+
+TEST_F(TestJsonStreamGenSplit, test_split_long_values_formatted) // NOLINT
+{
+    check_split_long_values(true, 0);
+}
+
+TEST_F(TestJsonStreamGenSplit, test_split_long_values_with_spill_buf) // NOLINT
+{
+    check_split_long_values(false, JSON_STREAM_GEN_CFG_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+TEST_F(TestJsonStreamGenSplit, test_split_long_string_chunks) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 10,
+        .flag_split_long_values = true,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            static const uint8_t buf[] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_BOOL(p_gen, "a", true);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "s", "0123456789\n");
+            JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "h", buf, sizeof(buf));
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{\"a\":true"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",\"s\":\"012"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("3456789\\n"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("\""), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(",\"h\":\"01"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("02030405\""), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("}"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+}
+
+TEST_F(TestJsonStreamGenSplit, test_long_string_without_splitting) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 10,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "s", "0123456789");
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string("{"), string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_EQ(nullptr, p_chunk);
+}
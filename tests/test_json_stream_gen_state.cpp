@@ -0,0 +1,329 @@
+/**
+ * @file test_json_stream_gen_state.cpp
+ * @author TheSomeMan
+ * @date 2026-10-17
+ * @copyright Ruuvi Innovations Ltd, license BSD-3-Clause.
+ */
+
+#include "json_stream_gen.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <string>
+#include <vector>
+#include "json_stream_gen_wrapper.h"
+
+using namespace std;
+
+/*** Google-test class implementation
+ * *********************************************************************************/
+
+class TestJsonStreamGenState;
+static TestJsonStreamGenState* g_pTestClass;
+
+class TestJsonStreamGenState : public ::testing::Test
+{
+private:
+protected:
+    void
+    SetUp() override
+    {
+        g_pTestClass = this;
+    }
+
+    void
+    TearDown() override
+    {
+        g_pTestClass = nullptr;
+    }
+
+public:
+    TestJsonStreamGenState();
+
+    ~TestJsonStreamGenState() override;
+};
+
+TestJsonStreamGenState::TestJsonStreamGenState()
+    : Test()
+{
+}
+
+TestJsonStreamGenState::~TestJsonStreamGenState() = default;
+
+/**
+ * @brief The layout of the saved state, it must match jsg_saved_state_t in json_stream_gen.c.
+ */
+typedef struct test_saved_state_t
+{
+    uint32_t magic;
+    int32_t  json_stream_gen_step;
+    int32_t  json_stream_gen_stage;
+    int32_t  resume_point;
+    int32_t  resume_step;
+    uint32_t cur_nesting_level;
+    uint32_t json_gen_state;
+    uint32_t spill_state;
+    uint8_t  is_first_item;
+    uint8_t  is_array_started;
+    uint8_t  is_value_split;
+    size_t   array_elem_idx;
+    size_t   value_offset;
+    size_t   skip_len;
+    size_t   spill_len;
+} test_saved_state_t;
+
+static string
+generate_json(json_stream_gen_t* const p_gen, const json_stream_gen_size_t max_chunk_size)
+{
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        if (nullptr == p_chunk)
+        {
+            return string("<error>");
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        if (strlen(p_chunk) >= (size_t)max_chunk_size)
+        {
+            return string("<chunk overflow>");
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+/*** Unit-Tests
+ * *******************************************************************************************************/
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    cb_generate_json_sub_obj,
+    json_stream_gen_t* const p_gen,
+    const void* const        p_user_ctx)
+{
+    (void)p_user_ctx;
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "key1", 100);
+    JSON_STREAM_GEN_ADD_DOUBLE(p_gen, "key2", 2.718281828459045);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    static const int64_t g_arr[] = { -1, 0, 1, 9223372036854775807LL, -9223372036854775807LL - 1 };
+    static const uint8_t g_buf[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0x01, 0x23, 0x45, 0x67 };
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "str", "value\twith\"escaping\" and a long tail which has to be split");
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "obj");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_sub_obj, p_gen, p_user_ctx);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_ADD_INT64_ARRAY(p_gen, "arr", g_arr, sizeof(g_arr) / sizeof(g_arr[0]));
+    JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "hex", g_buf, sizeof(g_buf));
+    JSON_STREAM_GEN_START_ARRAY(p_gen, "floats");
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        JSON_STREAM_GEN_ADD_FLOAT_TO_ARRAY(p_gen, (float)i * 1.1f);
+    }
+    JSON_STREAM_GEN_END_ARRAY(p_gen);
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "bool", true);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_save_and_restore_state(const json_stream_gen_cfg_t& cfg)
+{
+    JsonStreamGenWrapper wrapper       = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    const string         expected_json = generate_json(wrapper.get(), cfg.max_chunk_size);
+    ASSERT_EQ('{', expected_json[0]);
+
+    for (uint32_t num_chunks_before_saving = 0;; ++num_chunks_before_saving)
+    {
+        json_stream_gen_t* const p_gen = wrapper.get();
+        json_stream_gen_reset(p_gen);
+        string json_str("");
+        for (uint32_t i = 0; i < num_chunks_before_saving; ++i)
+        {
+            const char* const p_chunk = json_stream_gen_get_next_chunk(p_gen);
+            ASSERT_NE(nullptr, p_chunk);
+            json_str += string(p_chunk);
+        }
+        if (json_str == expected_json)
+        {
+            break;
+        }
+        vector<uint8_t> saved_state(json_stream_gen_get_saved_state_size(p_gen));
+        ASSERT_FALSE(json_stream_gen_save_state(p_gen, saved_state.data(), saved_state.size() - 1));
+        ASSERT_TRUE(json_stream_gen_save_state(p_gen, saved_state.data(), saved_state.size()));
+
+        // Reuse the generator for another request.
+        json_stream_gen_reset(p_gen);
+        ASSERT_EQ(expected_json, generate_json(p_gen, cfg.max_chunk_size));
+
+        ASSERT_TRUE(json_stream_gen_restore_state(p_gen, saved_state.data(), saved_state.size()));
+        ASSERT_EQ(expected_json, json_str + generate_json(p_gen, cfg.max_chunk_size))
+            << "num_chunks_before_saving=" << num_chunks_before_saving;
+
+        // Restore the state into another instance of the generator.
+        JsonStreamGenWrapper wrapper2 = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+        ASSERT_TRUE(json_stream_gen_restore_state(wrapper2.get(), saved_state.data(), saved_state.size()));
+        ASSERT_EQ(expected_json, json_str + generate_json(wrapper2.get(), cfg.max_chunk_size))
+            << "num_chunks_before_saving=" << num_chunks_before_saving;
+    }
+}
+
+TEST_F(TestJsonStreamGenState, test_save_and_restore_state_unformatted) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 80,
+    };
+    check_save_and_restore_state(cfg);
+}
+
+TEST_F(TestJsonStreamGenState, test_save_and_restore_state_formatted) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = 100,
+        .flag_formatted_json = true,
+    };
+    check_save_and_restore_state(cfg);
+}
+
+TEST_F(TestJsonStreamGenState, test_save_and_restore_state_with_spill_buf_and_split_values) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 40,
+        .sub_func_cache_size    = 4,
+        .spill_buf_size         = 40,
+        .flag_split_long_values = true,
+    };
+    check_save_and_restore_state(cfg);
+}
+
+TEST_F(TestJsonStreamGenState, test_save_and_restore_state_with_packed_chunks) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size         = 32,
+        .flag_split_long_values = true,
+        .flag_pack_chunks       = true,
+    };
+    check_save_and_restore_state(cfg);
+}
+
+TEST_F(TestJsonStreamGenState, test_save_and_restore_state_with_packed_chunks_and_split_values) // NOLINT
+{
+    // The part of the split value which does not fit into the packed chunk is carried over in the spill buffer.
+    for (json_stream_gen_size_t max_chunk_size = 64; max_chunk_size >= 26; max_chunk_size--)
+    {
+        const json_stream_gen_cfg_t cfg = {
+            .max_chunk_size         = max_chunk_size,
+            .flag_split_long_values = true,
+            .flag_pack_chunks       = true,
+        };
+        check_save_and_restore_state(cfg);
+        ASSERT_FALSE(HasFatalFailure()) << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+TEST_F(TestJsonStreamGenState, test_save_and_restore_state_after_seek) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 80,
+    };
+    JsonStreamGenWrapper wrapper       = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    const string         expected_json = generate_json(wrapper.get(), cfg.max_chunk_size);
+    json_stream_gen_t*   p_gen         = wrapper.get();
+
+    ASSERT_TRUE(json_stream_gen_seek(p_gen, 50));
+    vector<uint8_t> saved_state(json_stream_gen_get_saved_state_size(p_gen));
+    ASSERT_TRUE(json_stream_gen_save_state(p_gen, saved_state.data(), saved_state.size()));
+    json_stream_gen_reset(p_gen);
+    ASSERT_TRUE(json_stream_gen_restore_state(p_gen, saved_state.data(), saved_state.size()));
+    ASSERT_EQ(expected_json.substr(50), generate_json(p_gen, cfg.max_chunk_size));
+}
+
+TEST_F(TestJsonStreamGenState, test_restore_invalid_state) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 80,
+        .spill_buf_size = 80,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    json_stream_gen_t*   p_gen   = wrapper.get();
+    const char*          p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    const string first_chunk(p_chunk);
+
+    vector<uint8_t> saved_state(json_stream_gen_get_saved_state_size(p_gen));
+    ASSERT_TRUE(json_stream_gen_save_state(p_gen, saved_state.data(), saved_state.size()));
+    json_stream_gen_reset(p_gen);
+    // The next item is pending in the spill buffer.
+    ASSERT_LT(json_stream_gen_get_saved_state_size(p_gen), saved_state.size());
+
+    // The saved state is truncated.
+    ASSERT_FALSE(json_stream_gen_restore_state(p_gen, saved_state.data(), 4));
+    ASSERT_FALSE(json_stream_gen_restore_state(p_gen, saved_state.data(), saved_state.size() - 1));
+
+    // The saved state is corrupted.
+    vector<uint8_t> corrupted_state = saved_state;
+    corrupted_state[0] ^= 0xFFU;
+    ASSERT_FALSE(json_stream_gen_restore_state(p_gen, corrupted_state.data(), corrupted_state.size()));
+
+    // The pending bytes do not fit into the spill buffer of the generator.
+    cfg.spill_buf_size            = 0;
+    JsonStreamGenWrapper wrapper2 = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    ASSERT_FALSE(json_stream_gen_restore_state(wrapper2.get(), saved_state.data(), saved_state.size()));
+
+    // The generator is not affected by the failed attempts to restore the state.
+    json_stream_gen_reset(p_gen);
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(first_chunk, string(p_chunk));
+}
+
+TEST_F(TestJsonStreamGenState, test_restore_inconsistent_state) // NOLINT
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 80,
+        .spill_buf_size = 80,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json, 0, nullptr);
+    json_stream_gen_t*   p_gen   = wrapper.get();
+    ASSERT_NE(nullptr, json_stream_gen_get_next_chunk(p_gen));
+
+    vector<uint8_t> saved_state(json_stream_gen_get_saved_state_size(p_gen));
+    ASSERT_TRUE(json_stream_gen_save_state(p_gen, saved_state.data(), saved_state.size()));
+    test_saved_state_t state = {};
+    memcpy(&state, saved_state.data(), sizeof(state));
+    ASSERT_EQ(saved_state.size(), sizeof(state) + state.spill_len);
+    ASSERT_NE(0U, state.spill_state); // The spill buffer is in use.
+
+    // The padding bytes are cleared.
+    vector<uint8_t> saved_state2(saved_state.size(), 0xAAU);
+    ASSERT_TRUE(json_stream_gen_save_state(p_gen, saved_state2.data(), saved_state2.size()));
+    ASSERT_EQ(saved_state, saved_state2);
+
+    const auto check_corrupted = [&](void (*p_corrupt)(test_saved_state_t* p_state)) {
+        vector<uint8_t>    corrupted_state = saved_state;
+        test_saved_state_t corrupted       = state;
+        p_corrupt(&corrupted);
+        memcpy(corrupted_state.data(), &corrupted, sizeof(corrupted));
+        return json_stream_gen_restore_state(p_gen, corrupted_state.data(), corrupted_state.size());
+    };
+    ASSERT_TRUE(check_corrupted([](test_saved_state_t* p_state) { (void)p_state; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->json_gen_state = 6; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->json_gen_state = 0xFFFFFFFFU; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->spill_state = 3; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->is_first_item = 2; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->is_array_started = 0xFF; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->is_value_split = 1; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->spill_state = 0; }));
+    ASSERT_FALSE(check_corrupted([](test_saved_state_t* p_state) { p_state->spill_len = 0; }));
+
+    // The generator is not affected by the failed attempts to restore the state.
+    json_stream_gen_reset(p_gen);
+    ASSERT_TRUE(json_stream_gen_restore_state(p_gen, saved_state.data(), saved_state.size()));
+    const string json_str = generate_json(p_gen, cfg.max_chunk_size);
+    ASSERT_EQ('}', json_str.back());
+}
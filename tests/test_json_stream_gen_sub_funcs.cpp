@@ -147,3 +147,267 @@ TEST_F(TestJsonStreamGenSF, test_sub_funcs) // NOLINT
             json_str);
     }
 }
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    cb_generate_json_sub_obj_with_gen_as_second_arg,
+    const int32_t            base,
+    json_stream_gen_t* const p_gen)
+{
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "key1", base + 1);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "key2", base + 2);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_with_gen_as_second_arg(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    (void)p_user_ctx;
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "obj1");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(cb_generate_json_sub_obj_with_gen_as_second_arg, 100, p_gen);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "obj2");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC(cb_generate_json_sub_obj_with_gen_as_second_arg, 200, p_gen);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+TEST_F(TestJsonStreamGenSF, test_sub_funcs_not_cached_with_any_args) // NOLINT
+{
+    for (json_stream_gen_size_t max_chunk_size = 80; max_chunk_size > 12; max_chunk_size--)
+    {
+        // The sub-functions called without caching are not affected by the cache.
+        json_stream_gen_cfg_t cfg = {
+            .max_chunk_size      = max_chunk_size,
+            .sub_func_cache_size = 2,
+        };
+        JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json_with_gen_as_second_arg, 0, nullptr);
+        json_stream_gen_t*   p_gen   = wrapper.get();
+
+        string json_str("");
+        while (true)
+        {
+            const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+            ASSERT_NE(nullptr, p_chunk);
+            if ('\0' == p_chunk[0])
+            {
+                break;
+            }
+            json_str += string(p_chunk);
+        }
+        ASSERT_EQ(string("{\"obj1\":{\"key1\":101,\"key2\":102},\"obj2\":{\"key1\":201,\"key2\":202}}"), json_str);
+    }
+}
+
+#define TEST_SUB_FUNCS_NUM_TAGS (8U)
+
+typedef struct test_sub_funcs_ctx_t
+{
+    uint32_t cnt_tag_calls;
+    uint32_t cnt_values_calls;
+} test_sub_funcs_ctx_t;
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    cb_generate_json_tag_values,
+    json_stream_gen_t* const p_gen,
+    const void* const        p_user_ctx,
+    const uint32_t           tag_idx)
+{
+    auto p_ctx = static_cast<test_sub_funcs_ctx_t*>(const_cast<void*>(p_user_ctx));
+    p_ctx->cnt_values_calls += 1;
+    JSON_STREAM_GEN_ADD_UINT32(p_gen, "rssi", 50U + tag_idx);
+    JSON_STREAM_GEN_ADD_FLOAT_LIMITED_FIXED_POINT(
+        p_gen,
+        "temperature",
+        (float)tag_idx + 0.5f,
+        JSON_STREAM_GEN_NUM_DECIMALS_FLOAT_1);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(
+    cb_generate_json_tag,
+    json_stream_gen_t* const p_gen,
+    const void* const        p_user_ctx,
+    const uint32_t           tag_idx)
+{
+    static const char* const g_tag_names[TEST_SUB_FUNCS_NUM_TAGS] = {
+        "tag0", "tag1", "tag2", "tag3", "tag4", "tag5", "tag6", "tag7",
+    };
+    auto p_ctx = static_cast<test_sub_funcs_ctx_t*>(const_cast<void*>(p_user_ctx));
+    p_ctx->cnt_tag_calls += 1;
+    JSON_STREAM_GEN_START_OBJECT(p_gen, g_tag_names[tag_idx]);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "mac", "AA:BB:CC:DD:EE:FF");
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_tag_values, p_gen, p_user_ctx, tag_idx);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_tags(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "gw", "gateway");
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "tags");
+    for (uint32_t i = 0; i < TEST_SUB_FUNCS_NUM_TAGS; ++i)
+    {
+        JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_tag, p_gen, p_user_ctx, i);
+    }
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static string
+get_expected_json_tags()
+{
+    string json_str("{\"gw\":\"gateway\",\"tags\":{");
+    for (uint32_t i = 0; i < TEST_SUB_FUNCS_NUM_TAGS; ++i)
+    {
+        if (0 != i)
+        {
+            json_str += ",";
+        }
+        json_str += "\"tag" + to_string(i) + "\":{\"mac\":\"AA:BB:CC:DD:EE:FF\",\"rssi\":" + to_string(50 + i)
+                    + ",\"temperature\":" + to_string(i) + ".5}";
+    }
+    json_str += "}}";
+    return json_str;
+}
+
+TEST_F(TestJsonStreamGenSF, test_sub_funcs_cache) // NOLINT
+{
+    for (uint32_t sub_func_cache_size = 0; sub_func_cache_size <= TEST_SUB_FUNCS_NUM_TAGS; ++sub_func_cache_size)
+    {
+        for (json_stream_gen_size_t max_chunk_size = 150; max_chunk_size > 30; max_chunk_size--)
+        {
+            json_stream_gen_cfg_t cfg = {
+                .max_chunk_size      = max_chunk_size,
+                .sub_func_cache_size = sub_func_cache_size,
+            };
+            test_sub_funcs_ctx_t*                 p_ctx     = nullptr;
+            std::unique_ptr<JsonStreamGenWrapper> p_wrapper = std::make_unique<JsonStreamGenWrapper>(
+                &cfg,
+                &cb_generate_json_tags,
+                sizeof(*p_ctx),
+                (void**)&p_ctx);
+            json_stream_gen_t* p_gen = p_wrapper->get();
+
+            string   json_str("");
+            uint32_t cnt_chunks = 0;
+            while (true)
+            {
+                const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+                ASSERT_NE(nullptr, p_chunk);
+                if ('\0' == p_chunk[0])
+                {
+                    break;
+                }
+                json_str += string(p_chunk);
+                cnt_chunks += 1;
+            }
+            ASSERT_EQ(get_expected_json_tags(), json_str);
+            if (TEST_SUB_FUNCS_NUM_TAGS == sub_func_cache_size)
+            {
+                // A completed sub-generator is never called again,
+                // so each chunk calls at most one sub-generator which was not completed in the previous chunks.
+                ASSERT_LE(p_ctx->cnt_tag_calls, TEST_SUB_FUNCS_NUM_TAGS + cnt_chunks);
+                ASSERT_LE(p_ctx->cnt_values_calls, TEST_SUB_FUNCS_NUM_TAGS + cnt_chunks);
+            }
+        }
+    }
+}
+
+TEST_F(TestJsonStreamGenSF, test_sub_funcs_cache_reset) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = 64,
+        .sub_func_cache_size = TEST_SUB_FUNCS_NUM_TAGS,
+    };
+    test_sub_funcs_ctx_t* p_ctx   = nullptr;
+    JsonStreamGenWrapper  wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json_tags, sizeof(*p_ctx), (void**)&p_ctx);
+    json_stream_gen_t*    p_gen   = wrapper.get();
+
+    ASSERT_EQ((json_stream_gen_size_t)get_expected_json_tags().size(), json_stream_gen_calc_size(p_gen));
+
+    string json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        ASSERT_NE(nullptr, p_chunk);
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        json_str += string(p_chunk);
+    }
+    ASSERT_EQ(get_expected_json_tags(), json_str);
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(cb_generate_json_nested_inner, json_stream_gen_t* const p_gen)
+{
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "a", 1);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "b", 2);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static JSON_STREAM_GEN_DECL_GENERATOR_SUB_FUNC(cb_generate_json_nested_outer, json_stream_gen_t* const p_gen)
+{
+    // The nested sub-generator starts at the same step as the outer one.
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_nested_inner, p_gen);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "cccccccccc", 3);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "dddddddddd", 4);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "eeeeeeeeee", 5);
+    JSON_STREAM_GEN_END_GENERATOR_SUB_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_nested(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    (void)p_user_ctx;
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_nested_outer, p_gen);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "z", 9);
+    JSON_STREAM_GEN_CALL_GENERATOR_SUB_FUNC_CACHED(p_gen, cb_generate_json_nested_outer, p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static string
+generate_json_nested(const json_stream_gen_size_t max_chunk_size, const uint32_t sub_func_cache_size)
+{
+    const json_stream_gen_cfg_t cfg = {
+        .max_chunk_size      = max_chunk_size,
+        .sub_func_cache_size = sub_func_cache_size,
+    };
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_json_nested, 0, nullptr);
+    string               json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(wrapper.get());
+        if (nullptr == p_chunk)
+        {
+            return string("<error>");
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+TEST_F(TestJsonStreamGenSF, test_sub_funcs_cache_nested_at_same_step) // NOLINT
+{
+    for (json_stream_gen_size_t max_chunk_size = 120; max_chunk_size > 20; max_chunk_size--)
+    {
+        const string expected_json = generate_json_nested(max_chunk_size, 0);
+        ASSERT_EQ(
+            string("{\"a\":1,\"b\":2,\"cccccccccc\":3,\"dddddddddd\":4,\"eeeeeeeeee\":5,\"z\":9,"
+                   "\"a\":1,\"b\":2,\"cccccccccc\":3,\"dddddddddd\":4,\"eeeeeeeeee\":5}"),
+            expected_json);
+        for (uint32_t sub_func_cache_size = 1; sub_func_cache_size <= 4; ++sub_func_cache_size)
+        {
+            ASSERT_EQ(expected_json, generate_json_nested(max_chunk_size, sub_func_cache_size))
+                << "max_chunk_size=" << max_chunk_size << ", sub_func_cache_size=" << sub_func_cache_size;
+        }
+    }
+}
@@ -7,7 +7,13 @@
 
 #include "json_stream_gen.h"
 #include "gtest/gtest.h"
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <ctime>
 #include <string>
+#include <utility>
+#include <vector>
 #include "json_stream_gen_wrapper.h"
 
 using namespace std;
@@ -488,6 +494,254 @@ TEST_F(TestJsonStreamGenU, test_generate_json_string_unformatted__with_escaping)
     }
 }
 
+TEST_F(TestJsonStreamGenU, test_generate_json_string_unformatted__escaping_at_any_position) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 256,
+    };
+    generate_single_string_t* p_ctx   = nullptr;
+    JsonStreamGenWrapper      wrapper = JsonStreamGenWrapper(
+        &cfg,
+        &cb_generate_single_string,
+        sizeof(*p_ctx),
+        (void**)&p_ctx);
+    ASSERT_NE(nullptr, p_ctx);
+    json_stream_gen_t* p_gen = wrapper.get();
+    p_ctx->p_name            = "k";
+
+    const std::vector<std::pair<char, string>> special_chars = {
+        { '\x01', "\\u0001" }, { '\x1F', "\\u001f" }, { '\"', "\\\"" }, { '\\', "\\\\" },
+        { '\n', "\\n" },       { ' ', " " },          { '\x7F', "\x7F" }, { '\xC3', "\xC3" },
+    };
+    // The strings are long enough to be checked by the vectorized code and by the byte-by-byte code for the tail.
+    for (size_t len = 1; len <= 80; ++len)
+    {
+        for (size_t pos = 0; pos < len; ++pos)
+        {
+            for (const auto& special_char : special_chars)
+            {
+                string val(len, 'a');
+                val[pos]            = special_char.first;
+                string expected_val = string(len, 'a');
+                expected_val.replace(pos, 1, special_char.second);
+                p_ctx->p_val = val.c_str();
+                json_stream_gen_reset(p_gen);
+                const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+                ASSERT_NE(nullptr, p_chunk);
+                ASSERT_EQ(string("{\"k\":\"") + expected_val + string("\"}"), string(p_chunk))
+                    << "len=" << len << ", pos=" << pos;
+            }
+        }
+    }
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_string_n_unformatted) // NOLINT
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        nullptr,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            // The buffers are not null-terminated.
+            static const char name[4]     = { 'a', 'b', 'c', 'd' };
+            static const char escaped[5]  = { 'a', '"', '\0', '\n', 'b' };
+            static const char mac_addr[6] = { 'A', 'A', ':', 'B', 'B', ':' };
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_STRING_N(p_gen, "name", name, 3);
+            JSON_STREAM_GEN_ADD_STRING_N(p_gen, "escaped", escaped, sizeof(escaped));
+            JSON_STREAM_GEN_ADD_STRING_N(p_gen, "empty", name, 0);
+            JSON_STREAM_GEN_ADD_STRING_N(p_gen, "null", nullptr, 0);
+            JSON_STREAM_GEN_ADD_RAW_STRING_N(p_gen, "mac", mac_addr, 5);
+            JSON_STREAM_GEN_ADD_RAW_STRING_N(p_gen, "raw_null", nullptr, 5);
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+            JSON_STREAM_GEN_ADD_STRING_N_TO_ARRAY(p_gen, escaped, 2);
+            JSON_STREAM_GEN_ADD_RAW_STRING_N_TO_ARRAY(p_gen, mac_addr, 2);
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{"
+               "\"name\":\"abc\","
+               "\"escaped\":\"a\\\"\\u0000\\nb\","
+               "\"empty\":\"\","
+               "\"null\":null,"
+               "\"mac\":\"AA:BB\","
+               "\"raw_null\":null,"
+               "\"arr\":[\"a\\\"\",\"AA\"]"
+               "}"),
+        string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_keys_with_escaping) // NOLINT
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        nullptr,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_INT32(p_gen, "key\"1", 1);
+            JSON_STREAM_GEN_ADD_STRING(p_gen, "key\\2", "val");
+            JSON_STREAM_GEN_START_OBJECT(p_gen, "obj\n");
+            JSON_STREAM_GEN_ADD_BOOL(p_gen, "\x01", true);
+            JSON_STREAM_GEN_END_OBJECT(p_gen);
+            JSON_STREAM_GEN_ADD_NULL(p_gen, "");
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{"
+               "\"key\\\"1\":1,"
+               "\"key\\\\2\":\"val\","
+               "\"obj\\n\":{\"\\u0001\":true},"
+               "\"\":null"
+               "}"),
+        string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_literal_keys) // NOLINT
+{
+    for (json_stream_gen_size_t max_chunk_size = 80; max_chunk_size > 16; max_chunk_size--)
+    {
+        const json_stream_gen_cfg_t cfg = {
+            .max_chunk_size = max_chunk_size,
+        };
+        JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+            &cfg,
+            [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+                (void)p_user_ctx;
+                char key_buf[16] = "key3";
+                JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+                JSON_STREAM_GEN_ADD_INT32(p_gen, JSON_STREAM_GEN_KEY(p_gen, "key1"), 1);
+                JSON_STREAM_GEN_ADD_STRING(p_gen, JSON_STREAM_GEN_KEY(p_gen, "key\"2"), "val");
+                JSON_STREAM_GEN_ADD_INT32(p_gen, key_buf, 3);
+                JSON_STREAM_GEN_START_OBJECT(p_gen, JSON_STREAM_GEN_KEY(p_gen, "obj"));
+                JSON_STREAM_GEN_ADD_BOOL(p_gen, JSON_STREAM_GEN_KEY(p_gen, ""), true);
+                JSON_STREAM_GEN_END_OBJECT(p_gen);
+                JSON_STREAM_GEN_ADD_NULL(p_gen, "key1");
+                JSON_STREAM_GEN_END_GENERATOR_FUNC();
+            },
+            0,
+            nullptr);
+        json_stream_gen_t* p_gen = wrapper.get();
+
+        string json_str("");
+        while (true)
+        {
+            const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+            ASSERT_NE(nullptr, p_chunk);
+            if ('\0' == p_chunk[0])
+            {
+                break;
+            }
+            json_str += string(p_chunk);
+        }
+        ASSERT_EQ(
+            string("{"
+                   "\"key1\":1,"
+                   "\"key\\\"2\":\"val\","
+                   "\"key3\":3,"
+                   "\"obj\":{\"\":true},"
+                   "\"key1\":null"
+                   "}"),
+            json_str)
+            << "max_chunk_size=" << max_chunk_size;
+    }
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_escaped_keys(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    (void)p_user_ctx;
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, "quote\"key", 1);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, "back\\slash");
+    JSON_STREAM_GEN_ADD_STRING(p_gen, "tab\tand\nnewline", "val");
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, "\x01\x1F", true);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_json_escaped_literal_keys(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    (void)p_user_ctx;
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_INT32(p_gen, JSON_STREAM_GEN_KEY(p_gen, "quote\"key"), 1);
+    JSON_STREAM_GEN_START_OBJECT(p_gen, JSON_STREAM_GEN_KEY(p_gen, "back\\slash"));
+    JSON_STREAM_GEN_ADD_STRING(p_gen, JSON_STREAM_GEN_KEY(p_gen, "tab\tand\nnewline"), "val");
+    JSON_STREAM_GEN_ADD_BOOL(p_gen, JSON_STREAM_GEN_KEY(p_gen, "\x01\x1F"), true);
+    JSON_STREAM_GEN_END_OBJECT(p_gen);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static string
+generate_json_in_chunks(const json_stream_gen_cfg_t& cfg, const json_stream_gen_cb_generate_next_t cb_gen_next)
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, cb_gen_next, 0, nullptr);
+    string               json_str("");
+    while (true)
+    {
+        const char* p_chunk = json_stream_gen_get_next_chunk(wrapper.get());
+        if (nullptr == p_chunk)
+        {
+            return string("<error>");
+        }
+        if ('\0' == p_chunk[0])
+        {
+            break;
+        }
+        json_str += string(p_chunk);
+    }
+    return json_str;
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_escaped_literal_keys) // NOLINT
+{
+    for (const bool flag_formatted_json : { false, true })
+    {
+        for (json_stream_gen_size_t max_chunk_size = 120; max_chunk_size > 36; max_chunk_size--)
+        {
+            const json_stream_gen_cfg_t cfg = {
+                .max_chunk_size      = max_chunk_size,
+                .flag_formatted_json = flag_formatted_json,
+            };
+            const string expected_json = generate_json_in_chunks(cfg, &cb_generate_json_escaped_keys);
+            if (!flag_formatted_json)
+            {
+                ASSERT_EQ(
+                    string("{"
+                           "\"quote\\\"key\":1,"
+                           "\"back\\\\slash\":{"
+                           "\"tab\\tand\\nnewline\":\"val\","
+                           "\"\\u0001\\u001f\":true"
+                           "}"
+                           "}"),
+                    expected_json);
+            }
+            ASSERT_EQ(expected_json, generate_json_in_chunks(cfg, &cb_generate_json_escaped_literal_keys))
+                << "max_chunk_size=" << max_chunk_size;
+        }
+    }
+}
+
 TEST_F(TestJsonStreamGenU, test_generate_json_string_unformatted__without_escaping) // NOLINT
 {
     for (json_stream_gen_size_t max_chunk_size = 63; max_chunk_size > 34; max_chunk_size--)
@@ -782,6 +1036,67 @@ TEST_F(TestJsonStreamGenU, test_generate_json_int32) // NOLINT
         string(p_chunk));
 }
 
+TEST_F(TestJsonStreamGenU, test_generate_json_integers_of_all_lengths) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {};
+
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        &cfg,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+            for (uint64_t val = 1;; val *= 10U)
+            {
+                // Check the numbers with every number of digits and the boundaries between them.
+                JSON_STREAM_GEN_ADD_UINT64_TO_ARRAY(p_gen, val - 1U);
+                JSON_STREAM_GEN_ADD_UINT64_TO_ARRAY(p_gen, val);
+                JSON_STREAM_GEN_ADD_INT64_TO_ARRAY(p_gen, -(int64_t)val);
+                if (val <= UINT32_MAX)
+                {
+                    JSON_STREAM_GEN_ADD_UINT32_TO_ARRAY(p_gen, (uint32_t)(val + 7U));
+                }
+                if (val <= INT32_MAX)
+                {
+                    JSON_STREAM_GEN_ADD_INT32_TO_ARRAY(p_gen, -(int32_t)(val + 3U));
+                }
+                if (val > (UINT64_MAX / 10U))
+                {
+                    break;
+                }
+            }
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    string expected_json("{\"arr\":[");
+    for (uint64_t val = 1;; val *= 10U)
+    {
+        expected_json += to_string(val - 1U) + "," + to_string(val) + "," + to_string(-(int64_t)val) + ",";
+        if (val <= UINT32_MAX)
+        {
+            expected_json += to_string((uint32_t)(val + 7U)) + ",";
+        }
+        if (val <= INT32_MAX)
+        {
+            expected_json += to_string(-(int32_t)(val + 3U)) + ",";
+        }
+        if (val > (UINT64_MAX / 10U))
+        {
+            break;
+        }
+    }
+    expected_json.back() = ']';
+    expected_json += "}";
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(expected_json, string(p_chunk));
+}
+
 TEST_F(TestJsonStreamGenU, test_generate_json_uint32) // NOLINT
 {
     json_stream_gen_cfg_t cfg = {};
@@ -942,6 +1257,265 @@ TEST_F(TestJsonStreamGenU, test_generate_json_hex_buf) // NOLINT
     }
 }
 
+typedef struct generate_hex_buf_t
+{
+    uint8_t buf[256];
+    size_t  len;
+} generate_hex_buf_t;
+
+static json_stream_gen_callback_result_t
+cb_generate_hex_buf(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<const generate_hex_buf_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_HEX_BUF(p_gen, "h", p_ctx->buf, p_ctx->len);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static void
+check_hex_buf_all_bytes(const bool flag_hex_lowercase)
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size     = 1024,
+        .flag_hex_lowercase = flag_hex_lowercase,
+    };
+    generate_hex_buf_t*  p_ctx   = nullptr;
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_hex_buf, sizeof(*p_ctx), (void**)&p_ctx);
+    json_stream_gen_t*   p_gen   = wrapper.get();
+    // The buffers of different lengths are converted by the vectorized code and by the table for the tail.
+    for (size_t len = 0; len <= sizeof(p_ctx->buf); ++len)
+    {
+        string expected_hex;
+        for (size_t i = 0; i < len; ++i)
+        {
+            p_ctx->buf[i] = (uint8_t)(255U - i);
+            std::array<char, 3> hex_digits {};
+            (void)snprintf(hex_digits.data(), hex_digits.size(), flag_hex_lowercase ? "%02x" : "%02X", p_ctx->buf[i]);
+            expected_hex += string(hex_digits.data());
+        }
+        p_ctx->len = len;
+        json_stream_gen_reset(p_gen);
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        ASSERT_NE(nullptr, p_chunk);
+        ASSERT_EQ(string("{\"h\":\"") + expected_hex + string("\"}"), string(p_chunk)) << "len=" << len;
+    }
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_hex_buf_all_bytes_uppercase) // NOLINT
+{
+    check_hex_buf_all_bytes(false);
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_hex_buf_all_bytes_lowercase) // NOLINT
+{
+    check_hex_buf_all_bytes(true);
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_base64) // NOLINT
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        nullptr,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            static const uint8_t foobar[] = { 'f', 'o', 'o', 'b', 'a', 'r' };
+            static const uint8_t bin[]    = { 0xFB, 0xFF, 0xBF };
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            // The test vectors from RFC 4648
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "base64");
+            for (size_t len = 0; len <= sizeof(foobar); ++len)
+            {
+                JSON_STREAM_GEN_ADD_BASE64_TO_ARRAY(p_gen, foobar, len);
+            }
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "base64url");
+            for (size_t len = 0; len <= sizeof(foobar); ++len)
+            {
+                JSON_STREAM_GEN_ADD_BASE64URL_TO_ARRAY(p_gen, foobar, len);
+            }
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_ADD_BASE64(p_gen, "bin", bin, sizeof(bin));
+            JSON_STREAM_GEN_ADD_BASE64URL(p_gen, "bin_url", bin, sizeof(bin));
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{"
+               "\"base64\":[\"\",\"Zg==\",\"Zm8=\",\"Zm9v\",\"Zm9vYg==\",\"Zm9vYmE=\",\"Zm9vYmFy\"],"
+               "\"base64url\":[\"\",\"Zg\",\"Zm8\",\"Zm9v\",\"Zm9vYg\",\"Zm9vYmE\",\"Zm9vYmFy\"],"
+               "\"bin\":\"+/+/\","
+               "\"bin_url\":\"-_-_\""
+               "}"),
+        string(p_chunk));
+}
+
+static string
+encode_base64(const uint8_t* const p_buf, const size_t len, const bool flag_url)
+{
+    const string alphabet = flag_url ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+                                     : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    string       res;
+    uint32_t     bits     = 0;
+    uint32_t     num_bits = 0;
+    for (size_t i = 0; i < len; ++i)
+    {
+        bits = (bits << 8U) | p_buf[i];
+        num_bits += 8;
+        while (num_bits >= 6)
+        {
+            num_bits -= 6;
+            res += alphabet[(bits >> num_bits) & 0x3FU];
+        }
+    }
+    if (0 != num_bits)
+    {
+        res += alphabet[(bits << (6U - num_bits)) & 0x3FU];
+    }
+    while ((!flag_url) && (0 != (res.size() % 4)))
+    {
+        res += '=';
+    }
+    return res;
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_base64(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_ctx = static_cast<const generate_hex_buf_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_BASE64(p_gen, "b", p_ctx->buf, p_ctx->len);
+    JSON_STREAM_GEN_ADD_BASE64URL(p_gen, "u", p_ctx->buf, p_ctx->len);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_base64_all_lengths) // NOLINT
+{
+    json_stream_gen_cfg_t cfg = {
+        .max_chunk_size = 1024,
+    };
+    generate_hex_buf_t*  p_ctx   = nullptr;
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(&cfg, &cb_generate_base64, sizeof(*p_ctx), (void**)&p_ctx);
+    json_stream_gen_t*   p_gen   = wrapper.get();
+    for (size_t i = 0; i < sizeof(p_ctx->buf); ++i)
+    {
+        p_ctx->buf[i] = (uint8_t)((i * 97U) + 13U);
+    }
+    // The buffers of different lengths are encoded by the vectorized code and by the table for the tail.
+    for (size_t len = 0; len <= sizeof(p_ctx->buf); ++len)
+    {
+        p_ctx->len = len;
+        json_stream_gen_reset(p_gen);
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        ASSERT_NE(nullptr, p_chunk);
+        ASSERT_EQ(
+            string("{\"b\":\"") + encode_base64(p_ctx->buf, len, false) + string("\",\"u\":\"")
+                + encode_base64(p_ctx->buf, len, true) + string("\"}"),
+            string(p_chunk))
+            << "len=" << len;
+    }
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_timestamps) // NOLINT
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        nullptr,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "epoch", 0);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "before_epoch", -1);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "leap_day", 951782400000LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "end_of_year", 1735689599123LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "year_1900", -2203845903211LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "min", -62167219200000LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "max", 253402300799999LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "below_min", -62167219200001LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "above_max", 253402300800000LL);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "int64_min", INT64_MIN);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_EPOCH_MS(p_gen, "epoch_ms", 1735689599123LL);
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+            JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601_TO_ARRAY(p_gen, 1000);
+            JSON_STREAM_GEN_ADD_TIMESTAMP_EPOCH_MS_TO_ARRAY(p_gen, -1);
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{"
+               "\"epoch\":\"1970-01-01T00:00:00.000Z\","
+               "\"before_epoch\":\"1969-12-31T23:59:59.999Z\","
+               "\"leap_day\":\"2000-02-29T00:00:00.000Z\","
+               "\"end_of_year\":\"2024-12-31T23:59:59.123Z\","
+               "\"year_1900\":\"1900-03-01T12:34:56.789Z\","
+               "\"min\":\"0000-01-01T00:00:00.000Z\","
+               "\"max\":\"9999-12-31T23:59:59.999Z\","
+               "\"below_min\":null,"
+               "\"above_max\":null,"
+               "\"int64_min\":null,"
+               "\"epoch_ms\":1735689599123,"
+               "\"arr\":[\"1970-01-01T00:00:01.000Z\",-1]"
+               "}"),
+        string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+}
+
+static json_stream_gen_callback_result_t
+cb_generate_timestamp(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    auto p_epoch_ms = static_cast<const int64_t*>(p_user_ctx);
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    JSON_STREAM_GEN_ADD_TIMESTAMP_ISO8601(p_gen, "t", *p_epoch_ms);
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_timestamp_iso8601_matches_gmtime) // NOLINT
+{
+    int64_t*             p_epoch_ms = nullptr;
+    JsonStreamGenWrapper wrapper    = JsonStreamGenWrapper(
+        nullptr,
+        &cb_generate_timestamp,
+        sizeof(*p_epoch_ms),
+        (void**)&p_epoch_ms);
+    json_stream_gen_t* p_gen = wrapper.get();
+    // The step is a week and a bit more than an hour, so all the days of the month and the times of day are covered.
+    const int64_t step_ms = (7LL * 86400000LL) + 3723007LL;
+    for (int64_t epoch_ms = -62167219200000LL; epoch_ms <= 253402300799999LL; epoch_ms += step_ms)
+    {
+        *p_epoch_ms      = epoch_ms;
+        const time_t sec = (time_t)((epoch_ms >= 0) ? (epoch_ms / 1000) : (((epoch_ms + 1) / 1000) - 1));
+        struct tm    tm_utc {};
+        ASSERT_NE(nullptr, gmtime_r(&sec, &tm_utc));
+        char expected[64];
+        (void)snprintf(
+            expected,
+            sizeof(expected),
+            "{\"t\":\"%04d-%02d-%02dT%02d:%02d:%02d.%03dZ\"}",
+            tm_utc.tm_year + 1900,
+            tm_utc.tm_mon + 1,
+            tm_utc.tm_mday,
+            tm_utc.tm_hour,
+            tm_utc.tm_min,
+            tm_utc.tm_sec,
+            (int)(((epoch_ms % 1000) + 1000) % 1000));
+        json_stream_gen_reset(p_gen);
+        const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+        ASSERT_NE(nullptr, p_chunk);
+        ASSERT_EQ(string(expected), string(p_chunk)) << "epoch_ms=" << epoch_ms;
+    }
+}
+
 TEST_F(TestJsonStreamGenU, test_generate_json_floats) // NOLINT
 {
     json_stream_gen_cfg_t cfg = {};
@@ -989,13 +1563,13 @@ TEST_F(TestJsonStreamGenU, test_generate_json_floats) // NOLINT
                "\"key_-16777215.0\":-16777215,"
                "\"key_16777216.0\":16777216,"
                "\"key_-16777216.0\":-16777216,"
-               "\"key_0.12345678\":0.123456784,"   // 0.12345678 -> 0.123456784
-               "\"key_-0.12345678\":-0.123456784," // -0.12345678 -> -0.123456784
+               "\"key_0.12345678\":0.12345678,"
+               "\"key_-0.12345678\":-0.12345678,"
                "\"key_100000.9\":100000.9,"
-               "\"key_100000.99\":100000.992,"
+               "\"key_100000.99\":100000.99,"
                "\"key_100000.999\":100001,"
                "\"key_-100000.9\":-100000.9,"
-               "\"key_-100000.99\":-100000.992,"
+               "\"key_-100000.99\":-100000.99,"
                "\"key_-100000.999\":-100001"
                "}"),
         string(p_chunk));
@@ -1110,7 +1684,7 @@ TEST_F(TestJsonStreamGenU, test_generate_json_doubles) // NOLINT
                "\"key_0.0\":0,"
                "\"key_0.1\":0.1,"
                "\"key_0.3\":0.3,"
-               "\"key_0.5555555555555555\":0.55555555555555547," // 0.5555555555555555 -> 0.55555555555555547
+               "\"key_0.5555555555555555\":0.5555555555555555,"
                "\"key_1.0\":1,"
                "\"key_-1.0\":-1,"
                "\"key_9007199254740992.0\":9007199254740992,"
@@ -1120,11 +1694,11 @@ TEST_F(TestJsonStreamGenU, test_generate_json_doubles) // NOLINT
                "\"key_0.12345678912345678\":0.12345678912345678,"
                "\"key_-0.12345678912345678\":-0.12345678912345678,"
                "\"key_16777215.9999999\":16777215.9999999,"
-               "\"key_16777215.99999999\":16777215.999999991,"
+               "\"key_16777215.99999999\":16777215.99999999,"
                "\"key_16777215.999999999\":16777215.999999998,"
                "\"key_16777215.9999999999\":16777216,"
                "\"key_-16777215.9999999\":-16777215.9999999,"
-               "\"key_-16777215.99999999\":-16777215.999999991,"
+               "\"key_-16777215.99999999\":-16777215.99999999,"
                "\"key_-16777215.999999999\":-16777215.999999998,"
                "\"key_-16777215.9999999999\":-16777216"
                "}"),
@@ -1210,6 +1784,249 @@ TEST_F(TestJsonStreamGenU, test_generate_json_doubles_with_precision) // NOLINT
         string(p_chunk));
 }
 
+typedef struct generate_single_ieee754_t
+{
+    bool   flag_double;
+    float  val_float;
+    double val_double;
+} generate_single_ieee754_t;
+
+static json_stream_gen_callback_result_t
+cb_generate_single_ieee754(json_stream_gen_t* const p_gen, const void* const p_user_ctx)
+{
+    const generate_single_ieee754_t* const p_ctx = (const generate_single_ieee754_t*)p_user_ctx;
+    JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+    if (p_ctx->flag_double)
+    {
+        JSON_STREAM_GEN_ADD_DOUBLE(p_gen, "v", p_ctx->val_double);
+    }
+    else
+    {
+        JSON_STREAM_GEN_ADD_FLOAT(p_gen, "v", p_ctx->val_float);
+    }
+    JSON_STREAM_GEN_END_GENERATOR_FUNC();
+}
+
+static string
+generate_single_ieee754_value(json_stream_gen_t* const p_gen)
+{
+    json_stream_gen_reset(p_gen);
+    const char* const p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    if (nullptr == p_chunk)
+    {
+        return string("<error>");
+    }
+    const string json_str(p_chunk);
+    const string prefix("{\"v\":");
+    if ((0 != json_str.find(prefix)) || ('}' != json_str.back()))
+    {
+        return string("<error>");
+    }
+    return json_str.substr(prefix.size(), json_str.size() - prefix.size() - 1);
+}
+
+static size_t
+count_significant_digits(const string& str)
+{
+    size_t num_digits         = 0;
+    size_t num_trailing_zeros = 0;
+    bool   flag_lead          = true;
+    for (const char c : str)
+    {
+        if (('e' == c) || ('E' == c))
+        {
+            break;
+        }
+        if ((c < '0') || (c > '9') || (flag_lead && ('0' == c)))
+        {
+            continue;
+        }
+        flag_lead = false;
+        num_digits += 1;
+        num_trailing_zeros = ('0' == c) ? (num_trailing_zeros + 1) : 0;
+    }
+    // The trailing zeros of an integer are not significant.
+    return num_digits - num_trailing_zeros;
+}
+
+/**
+ * @brief Returns the minimal number of significant digits which are needed to restore the value with printf.
+ */
+template<typename T>
+static size_t
+get_shortest_num_digits(const T val, const size_t max_digits, T (*p_strto)(const char*, char**))
+{
+    for (size_t num_digits = 1; num_digits < max_digits; ++num_digits)
+    {
+        std::array<char, 40> buf {};
+        (void)snprintf(buf.data(), buf.size(), "%.*e", (int)num_digits - 1, (double)val);
+        const T val2 = p_strto(buf.data(), nullptr);
+        if (0 == memcmp(&val, &val2, sizeof(val)))
+        {
+            return num_digits;
+        }
+    }
+    return max_digits;
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_floats_shortest_round_trip) // NOLINT
+{
+    generate_single_ieee754_t* p_ctx   = nullptr;
+    JsonStreamGenWrapper       wrapper = JsonStreamGenWrapper(
+        nullptr,
+        &cb_generate_single_ieee754,
+        sizeof(*p_ctx),
+        (void**)&p_ctx);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    p_ctx->flag_double = false;
+    p_ctx->val_float   = -0.0f;
+    ASSERT_EQ(string("-0"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 1e10f;
+    ASSERT_EQ(string("1e+10"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 1.5e-5f;
+    ASSERT_EQ(string("1.5e-05"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 0.0001f;
+    ASSERT_EQ(string("0.0001"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 1234567.0f;
+    ASSERT_EQ(string("1234567"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 12345678.0f;
+    ASSERT_EQ(string("12345678"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 3.4028235e38f; // FLT_MAX
+    ASSERT_EQ(string("3.4028235e+38"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_float = 1e-45f; // The minimal subnormal number
+    ASSERT_EQ(string("1e-45"), generate_single_ieee754_value(p_gen));
+    // Grisu2 printed one digit more than needed for these values.
+    p_ctx->val_float = 8.670208e+11f;
+    ASSERT_EQ(string("8.670208e+11"), generate_single_ieee754_value(p_gen));
+
+    uint32_t rnd = 0x12345678U;
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        rnd ^= rnd << 13U;
+        rnd ^= rnd >> 17U;
+        rnd ^= rnd << 5U;
+        float val = 0;
+        memcpy(&val, &rnd, sizeof(val));
+        if (std::isnan(val) || std::isinf(val))
+        {
+            continue;
+        }
+        p_ctx->val_float     = val;
+        const string val_str = generate_single_ieee754_value(p_gen);
+        const float  val2    = strtof(val_str.c_str(), nullptr);
+        ASSERT_EQ(0, memcmp(&val, &val2, sizeof(val))) << val_str;
+        ASSERT_GE(get_shortest_num_digits<float>(val, 9, &strtof), count_significant_digits(val_str)) << val_str;
+    }
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_doubles_shortest_round_trip) // NOLINT
+{
+    generate_single_ieee754_t* p_ctx   = nullptr;
+    JsonStreamGenWrapper       wrapper = JsonStreamGenWrapper(
+        nullptr,
+        &cb_generate_single_ieee754,
+        sizeof(*p_ctx),
+        (void**)&p_ctx);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    p_ctx->flag_double = true;
+    p_ctx->val_double  = -0.0;
+    ASSERT_EQ(string("-0"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = 1e100;
+    ASSERT_EQ(string("1e+100"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = 1.5e-5;
+    ASSERT_EQ(string("1.5e-05"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = 123456789012345.0;
+    ASSERT_EQ(string("123456789012345"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = 1234567890123456.0;
+    ASSERT_EQ(string("1234567890123456"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = 1.7976931348623157e308; // DBL_MAX
+    ASSERT_EQ(string("1.7976931348623157e+308"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = 5e-324; // The minimal subnormal number
+    ASSERT_EQ(string("5e-324"), generate_single_ieee754_value(p_gen));
+    // Grisu2 printed one digit more than needed for these values.
+    p_ctx->val_double = 93.8440251572327;
+    ASSERT_EQ(string("93.8440251572327"), generate_single_ieee754_value(p_gen));
+    p_ctx->val_double = -2.1406127740768e+19;
+    ASSERT_EQ(string("-2.1406127740768e+19"), generate_single_ieee754_value(p_gen));
+
+    uint64_t rnd = 0x123456789ABCDEF0ULL;
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        rnd ^= rnd << 13U;
+        rnd ^= rnd >> 7U;
+        rnd ^= rnd << 17U;
+        double val = 0;
+        memcpy(&val, &rnd, sizeof(val));
+        if (std::isnan(val) || std::isinf(val))
+        {
+            continue;
+        }
+        p_ctx->val_double    = val;
+        const string val_str = generate_single_ieee754_value(p_gen);
+        const double val2    = strtod(val_str.c_str(), nullptr);
+        ASSERT_EQ(0, memcmp(&val, &val2, sizeof(val))) << val_str;
+        ASSERT_GE(get_shortest_num_digits<double>(val, 17, &strtod), count_significant_digits(val_str)) << val_str;
+    }
+}
+
+TEST_F(TestJsonStreamGenU, test_generate_json_int32_scaled) // NOLINT
+{
+    JsonStreamGenWrapper wrapper = JsonStreamGenWrapper(
+        nullptr,
+        [](json_stream_gen_t* const p_gen, const void* const p_user_ctx) -> json_stream_gen_callback_result_t {
+            (void)p_user_ctx;
+            JSON_STREAM_GEN_BEGIN_GENERATOR_FUNC(p_gen);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_0", 2345, 2);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_1", -2345, 2);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_2", 5, 2);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_3", -5, 3);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_4", 0, 2);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_5", 100, 0);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_6", -100, 0);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_7", 1000, 3);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_8", INT32_MAX, 9);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_9", INT32_MIN, 9);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_10", INT32_MIN, 0);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_11", 7, 10);
+            JSON_STREAM_GEN_ADD_INT32_SCALED(p_gen, "key_12", 7, -1);
+            JSON_STREAM_GEN_START_ARRAY(p_gen, "arr");
+            JSON_STREAM_GEN_ADD_INT32_SCALED_TO_ARRAY(p_gen, 2150, 2);
+            JSON_STREAM_GEN_ADD_INT32_SCALED_TO_ARRAY(p_gen, -1, 1);
+            JSON_STREAM_GEN_END_ARRAY(p_gen);
+            JSON_STREAM_GEN_END_GENERATOR_FUNC();
+        },
+        0,
+        nullptr);
+    json_stream_gen_t* p_gen = wrapper.get();
+
+    const char* p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(
+        string("{"
+               "\"key_0\":23.45,"
+               "\"key_1\":-23.45,"
+               "\"key_2\":0.05,"
+               "\"key_3\":-0.005,"
+               "\"key_4\":0.00,"
+               "\"key_5\":100,"
+               "\"key_6\":-100,"
+               "\"key_7\":1.000,"
+               "\"key_8\":2.147483647,"
+               "\"key_9\":-2.147483648,"
+               "\"key_10\":-2147483648,"
+               "\"key_11\":null,"
+               "\"key_12\":null,"
+               "\"arr\":[21.50,-0.1]"
+               "}"),
+        string(p_chunk));
+
+    p_chunk = json_stream_gen_get_next_chunk(p_gen);
+    ASSERT_NE(nullptr, p_chunk);
+    ASSERT_EQ(string(""), string(p_chunk));
+}
+
 TEST_F(TestJsonStreamGenU, test_generate_json_fixed_float_0p0) // NOLINT
 {
     const json_stream_gen_cfg_t cfg     = {};